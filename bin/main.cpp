@@ -40,6 +40,7 @@
 #include <vector>
 #include <algorithm>
 #include <fstream>
+#include <stdexcept>
 
 #include <SDL.h>
 #include "jsonLoader.h"
@@ -52,6 +53,7 @@
 #include "MainMenu.h"
 #include "GameInitializer.h"
 #include "GameStorage.h"
+#include "FrameTimer.h"
 
 int main(int argc, char* argv[])
 {
@@ -64,13 +66,50 @@ int main(int argc, char* argv[])
     // Create a Process Manager
     auto processManager = std::make_shared<ProcessManager>();
     // Pass function to all processes to trigger events in the rest of the processes
-    passFunc_t passFunc = [processManager](const std::string& eventName, const json& eventData) {
-        processManager->triggerEventInAll(eventName, eventData);
+    EventQueue::setMainThread();
+    passFunc_t passFunc = [processManager, scheduler](EventId eventId, const json& eventData) {
+        if (!EventQueue::onMainThread()) {
+            EventQueue::post(eventId, eventData); // handlers only ever run on the main thread
+            return;
+        }
+        processManager->triggerEventInAll(eventId, eventData);
+        scheduler->notifyEvent(eventId, eventData); // tasks waiting in co_await event(...)
     };
 
+    // --headless [--ticks N]: no display or audio device, simulation only, stops after N ticks if given
+    long long maxTicks = -1;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--headless") {
+            headlessMode = true;
+        } else if (arg == "--ticks") {
+            bool valid = i + 1 < argc;
+            if (valid) {
+                try {
+                    size_t used = 0;
+                    std::string value = argv[++i];
+                    maxTicks = std::stoll(value, &used);
+                    valid = used == value.size() && maxTicks >= 0;
+                } catch (const std::invalid_argument&) {
+                    valid = false;
+                } catch (const std::out_of_range&) {
+                    valid = false;
+                }
+            }
+            if (!valid) {
+                error("Incorrect Usage: --headless [--ticks N], N a whole number >= 0");
+                return 1;
+            }
+        }
+    }
+
     // Create a Game Storage, has to load first to get the global variables from the json file
     auto gameStorage = std::make_shared<GameStorage>();
     gameStorage->load();
+    if (headlessMode) {
+        AUDIO_ENABLED = false; // not written back to the save, only ChangeConfigValue does that
+        scheduler->setHeadless(true);
+    }
 
     // Create a View process; this is the compliment to the gameInitializer; this will load chatbox and main menus
     auto viewProcess = std::make_shared<view>(passFunc, processManager);
@@ -87,6 +126,9 @@ int main(int argc, char* argv[])
     auto gameInitializer = std::make_shared<GameInitializer>(passFunc, processManager, gameStorage, scheduler);
     gameInitializer->Init();
     processManager->attachProcess(gameInitializer);
+    if (headlessMode) {
+        gameInitializer->StartHeadless();
+    }
 
     // Seed the random number generator
     if (debugMode == 1) {
@@ -109,6 +151,23 @@ int main(int argc, char* argv[])
         }
     });
 
+    viewProcess->RegisterCommand("framePacing", [scheduler, v = viewProcess.get()](std::string command, sList_t args, std::string message) {
+        FramePacer& pacer = scheduler->getPacer();
+        if (!args.empty()) {
+            if (args[0] == "spin") {
+                pacer.setMode(FramePacer::SPIN);
+            } else if (args[0] == "adaptive") {
+                pacer.setMode(FramePacer::ADAPTIVE);
+            } else if (args[0] != "reset") {
+                v->TriggerEvent("UFO::Chat::AddMessage", "Incorrect Usage: framePacing [spin|adaptive|reset]");
+                return;
+            }
+            pacer.resetStats();
+        }
+        print(pacer.report());
+        v->TriggerEvent("UFO::Chat::AddMessage", pacer.report());
+    });
+
     // Auto room from PNG
 //    scheduler->setTimeout(2000, [gameInitializer]() {
 //        print("Creating Room from PNG");
@@ -122,23 +181,52 @@ int main(int argc, char* argv[])
     std::this_thread::sleep_for(std::chrono::milliseconds(50)); // Sleep for 1 ms to allow the view process to initialize fully
     SDL_Window* window = viewProcess->getWindow();
 
+    long long ticks = 0;
     while (scheduler->isRunning()) {
+        FrameTimer::beginFrame();
         float deltaMs = scheduler->run();
+        EventQueue::drainPosted(passFunc); // events posted by timer / loader threads
 
         if (!(SDL_GetWindowFlags(window) & SDL_WINDOW_MINIMIZED)) {
-            processManager->updateProcessList(deltaMs, window);
+            // fixed steps, rendering below interpolates between the last two
+            for (int step = 0; step < scheduler->getSimulationSteps(); step++) {
+                scheduler->advanceGameStep(); // game timers and seconds() waits, paused with the simulation
+                processManager->updateProcessList(scheduler->getFixedDeltaMs(), window);
+                EventQueue::flush(EventQueue::SIMULATE, passFunc);
+            }
         }
+        EventQueue::flush(EventQueue::SIMULATE, passFunc);
+        FrameTimer::mark(FrameTimer::UPDATE);
 
-        viewProcess->update(deltaMs);
+        viewProcess->update(deltaMs); // flushes INPUT and RENDER, marks POLL, RENDER and PRESENT
+        EventQueue::flush(EventQueue::LATE, passFunc);
+        FrameTimer::mark(FrameTimer::LATE);
 
         if (viewProcess->isDone()) {
             scheduler->shutdown();
         }
 
         scheduler->wait();
+        FrameTimer::mark(FrameTimer::WAIT);
+        FrameTimer::endFrame();
+
+        if (maxTicks >= 0 && ++ticks >= maxTicks) {
+            scheduler->shutdown();
+        }
+    }
+
+    if (headlessMode) {
+        for (auto& s : FrameTimer::percentiles()) {
+            print(s.name, " p50/p95/p99/max ms: ", s.p50, s.p95, s.p99, s.max);
+        }
     }
 
+    EventQueue::clear();
     processManager->abortAllProcess();
 
+    if constexpr (EventProfiler::enabled) {
+        EventProfiler::dumpCsv("event_profile.csv");
+    }
+
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,99 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Peter Greek
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * Proper permission is grated by the copyright holder.
+ *
+ * Credit is attributed to the copyright holder in some form in the product.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+//
+// Created by xerxe on 10/18/2026.
+//
+
+#ifndef CSCI437_COLLISIONKERNELS_H
+#define CSCI437_COLLISIONKERNELS_H
+
+#include "Geometry.h"
+#include <cstdint>
+#include <vector>
+
+/*
+ * Batch collision tests over OBBs packed as parallel float arrays. Each test has a scalar, an SSE and an AVX2
+ * version; the widest one the CPU supports is picked the first time a kernel runs. Non x86 builds only have the
+ * scalar one. Results match the scalar Geometry.h tests (touching counts as a hit).
+ */
+struct OBBBatch {
+    std::vector<float> cx, cy; // center
+    std::vector<float> ax, ay; // unit axis along hx
+    std::vector<float> hx, hy; // half extents
+    std::vector<uint32_t> id;  // caller's id for each row
+
+    [[nodiscard]] size_t size() const { return id.size(); }
+
+    void push(const OBB& box, uint32_t rowId) {
+        cx.push_back(box.center.x);
+        cy.push_back(box.center.y);
+        ax.push_back(box.axis.x);
+        ay.push_back(box.axis.y);
+        hx.push_back(box.halfExtents.x);
+        hy.push_back(box.halfExtents.y);
+        id.push_back(rowId);
+    }
+
+    // Swap remove, the last row moves into i
+    void removeAt(size_t i) {
+        for (auto* column : {&cx, &cy, &ax, &ay, &hx, &hy}) {
+            (*column)[i] = column->back();
+            column->pop_back();
+        }
+        id[i] = id.back();
+        id.pop_back();
+    }
+
+    void clear() {
+        for (auto* column : {&cx, &cy, &ax, &ay, &hx, &hy}) column->clear();
+        id.clear();
+    }
+};
+
+enum class SimdLevel {
+    SCALAR,
+    SSE,
+    AVX2,
+};
+
+// Row of the first box in batch overlapping box, -1 if none
+int firstOverlap(const OBBBatch& batch, const AABB& box);
+// Row of the first box in batch containing point, -1 if none
+int firstContaining(const OBBBatch& batch, vector2 point);
+// out[i] = 1 if (xs[i], ys[i]) is inside box, else 0
+void pointsInOBB(const OBB& box, const float* xs, const float* ys, size_t count, uint8_t* out);
+
+[[nodiscard]] SimdLevel detectSimdLevel();
+[[nodiscard]] SimdLevel getSimdLevel();
+// Benchmarks use this to compare levels, a level the CPU lacks falls back to the best supported one
+void setSimdLevel(SimdLevel level);
+[[nodiscard]] const char* simdLevelName(SimdLevel level);
+
+#endif //CSCI437_COLLISIONKERNELS_H
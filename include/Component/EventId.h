@@ -0,0 +1,100 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Peter Greek
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * Proper permission is grated by the copyright holder.
+ *
+ * Credit is attributed to the copyright holder in some form in the product.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+//
+// Created by xerxe on 10/18/2026.
+//
+
+#ifndef CSCI437_EVENTID_H
+#define CSCI437_EVENTID_H
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <ostream>
+
+// An event name reduced to a 32 bit FNV-1a hash. Literal names hash at compile time and keep a pointer to the
+// literal for debug output, dynamic names go through the intern table (EventId.cpp) once. Handlers are keyed on
+// the hash, so dispatch never builds or compares strings.
+class EventId {
+public:
+    static constexpr uint32_t FNV_OFFSET = 2166136261u;
+    static constexpr uint32_t FNV_PRIME = 16777619u;
+    static constexpr char COMMAND_PREFIX[] = "__internal_command_";
+
+    static constexpr uint32_t hash(const char* str, size_t len, uint32_t seed = FNV_OFFSET) {
+        uint32_t h = seed;
+        for (size_t i = 0; i < len; i++) {
+            h ^= static_cast<uint8_t>(str[i]);
+            h *= FNV_PRIME;
+        }
+        return h;
+    }
+
+    // Literal names, "SDL::OnUpdate" -> hashed at compile time. consteval so a runtime char buffer can't bind here
+    // and leave a dangling name_ (or hash its unused tail), those have to go through string_view and the intern table
+    template <size_t N>
+    consteval EventId(const char (&name)[N]) : id(hash(name, N - 1)), name_(name) {}
+
+    // Dynamic names are interned so name() stays valid for the life of the program
+    EventId(const std::string& name) : EventId(intern(name)) {}
+    EventId(std::string_view name) : EventId(intern(name)) {}
+
+    constexpr EventId() : id(0), name_("") {}
+
+    // "__internal_command_" + command without building the string, used by chat commands
+    static EventId command(std::string_view command);
+    static EventId intern(std::string_view name);
+
+    // Records a name in the intern table, reports two names that hash to the same id
+    static void registerName(EventId eventId);
+
+    [[nodiscard]] constexpr uint32_t value() const { return id; }
+    [[nodiscard]] constexpr const char* name() const { return name_; }
+
+    constexpr bool operator==(const EventId& other) const { return id == other.id; }
+    constexpr bool operator!=(const EventId& other) const { return id != other.id; }
+
+private:
+    constexpr EventId(uint32_t id, const char* name) : id(id), name_(name) {}
+
+    uint32_t id;
+    const char* name_;
+};
+
+struct EventIdHash {
+    size_t operator()(const EventId& eventId) const { return eventId.value(); }
+};
+
+inline std::ostream& operator<<(std::ostream& os, const EventId& eventId) {
+    return os << eventId.name();
+}
+
+#endif //CSCI437_EVENTID_H
@@ -0,0 +1,280 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Peter Greek
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * Proper permission is grated by the copyright holder.
+ *
+ * Credit is attributed to the copyright holder in some form in the product.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+//
+// Created by xerxe on 10/18/2026.
+//
+
+
+#ifndef CSCI437_GEOMETRY_H
+#define CSCI437_GEOMETRY_H
+
+#include "vector2.h"
+#include <cmath>
+#include <cstddef>
+#include <utility>
+
+/*
+ * Fixed size shapes for the collision code. All of them are plain values and every test is inline, so a check
+ * never touches the heap. The vectorList_t functions in Util.cpp stay for the editor and other callers that aren't
+ * per frame.
+ */
+
+struct AABB {
+    vector2 min;
+    vector2 max;
+
+    static AABB fromCenter(vector2 center, vector2 halfExtents) {
+        return {center - halfExtents, center + halfExtents};
+    }
+
+    [[nodiscard]] bool contains(vector2 p) const {
+        return p.x >= min.x && p.x <= max.x && p.y >= min.y && p.y <= max.y;
+    }
+
+    [[nodiscard]] bool overlaps(const AABB& o) const {
+        return !(o.max.x < min.x || o.min.x > max.x || o.max.y < min.y || o.min.y > max.y);
+    }
+
+    [[nodiscard]] AABB expanded(float by) const {
+        return {min - vector2(by, by), max + vector2(by, by)};
+    }
+};
+
+// Four corners in winding order, the layout wall::corners and the old four element vectorList_t boxes use.
+// The SAT below assumes it is convex.
+struct Quad {
+    vector2 p[4];
+
+    vector2& operator[](size_t i) { return p[i]; }
+    const vector2& operator[](size_t i) const { return p[i]; }
+    [[nodiscard]] const vector2* begin() const { return p; }
+    [[nodiscard]] const vector2* end() const { return p + 4; }
+
+    static Quad fromAABB(const AABB& b) {
+        return {{b.min, {b.min.x, b.max.y}, b.max, {b.max.x, b.min.y}}};
+    }
+
+    [[nodiscard]] AABB bounds() const {
+        AABB b{p[0], p[0]};
+        for (int i = 1; i < 4; i++) {
+            b.min = {std::fmin(b.min.x, p[i].x), std::fmin(b.min.y, p[i].y)};
+            b.max = {std::fmax(b.max.x, p[i].x), std::fmax(b.max.y, p[i].y)};
+        }
+        return b;
+    }
+
+    // Every edge runs along x or y
+    [[nodiscard]] bool isAxisAligned() const {
+        for (int i = 0; i < 4; i++) {
+            const vector2& a = p[i];
+            const vector2& b = p[(i + 1) & 3];
+            if (a.x != b.x && a.y != b.y) return false;
+        }
+        return true;
+    }
+
+    // Crossing number, same edge rule as isPointInBounds
+    [[nodiscard]] bool contains(vector2 point) const {
+        bool oddNodes = false;
+        for (int i = 0, j = 3; i < 4; j = i++) {
+            if ((p[i].y < point.y && p[j].y >= point.y) || (p[j].y < point.y && p[i].y >= point.y)) {
+                if (p[i].x + (point.y - p[i].y) / (p[j].y - p[i].y) * (p[j].x - p[i].x) < point.x) {
+                    oddNodes = !oddNodes;
+                }
+            }
+        }
+        return oddNodes;
+    }
+};
+
+// Box with its own axes. Walls and lasers are stored as a start point, a heading, a length along it and a width
+// across it; fromSegment builds that shape.
+struct OBB {
+    vector2 center;
+    vector2 axis; // unit, runs along halfExtents.x
+    vector2 halfExtents;
+
+    static OBB fromSegment(vector2 start, vector2 dir, float length, float width) {
+        return {start + dir * (length / 2.0f), dir, {length / 2.0f, width / 2.0f}};
+    }
+
+    [[nodiscard]] Quad corners() const {
+        vector2 u = axis * halfExtents.x;
+        vector2 v = vector2(-axis.y, axis.x) * halfExtents.y;
+        return {{center - u - v, center - u + v, center + u + v, center + u - v}};
+    }
+
+    [[nodiscard]] AABB bounds() const {
+        float ex = std::fabs(axis.x) * halfExtents.x + std::fabs(axis.y) * halfExtents.y;
+        float ey = std::fabs(axis.y) * halfExtents.x + std::fabs(axis.x) * halfExtents.y;
+        return AABB::fromCenter(center, {ex, ey});
+    }
+
+    [[nodiscard]] bool contains(vector2 point) const {
+        vector2 d = point - center;
+        return std::fabs(d.dot(axis)) <= halfExtents.x
+            && std::fabs(d.x * -axis.y + d.y * axis.x) <= halfExtents.y;
+    }
+};
+
+// Projection of q onto axis. The axis doesn't need to be unit length, both shapes are scaled the same
+inline void projectQuad(const Quad& q, vector2 axis, float& lo, float& hi) {
+    lo = hi = q.p[0].dot(axis);
+    for (int i = 1; i < 4; i++) {
+        float d = q.p[i].dot(axis);
+        lo = std::fmin(lo, d);
+        hi = std::fmax(hi, d);
+    }
+}
+
+inline bool separatedOn(const Quad& a, const Quad& b, vector2 axis) {
+    float aLo, aHi, bLo, bHi;
+    projectQuad(a, axis, aLo, aHi);
+    projectQuad(b, axis, bLo, bHi);
+    return aHi < bLo || bHi < aLo;
+}
+
+// SAT over the edge normals of both quads. Touching counts as overlapping, like isRectangleInRectangle
+inline bool overlaps(const Quad& a, const Quad& b) {
+    for (int i = 0; i < 4; i++) {
+        vector2 ea = a.p[(i + 1) & 3] - a.p[i];
+        if (separatedOn(a, b, {-ea.y, ea.x})) return false;
+        vector2 eb = b.p[(i + 1) & 3] - b.p[i];
+        if (separatedOn(a, b, {-eb.y, eb.x})) return false;
+    }
+    return true;
+}
+
+// Half the width of b projected onto n
+inline float projectedRadius(const OBB& b, vector2 n) {
+    return b.halfExtents.x * std::fabs(b.axis.dot(n)) + b.halfExtents.y * std::fabs(b.axis.x * n.y - b.axis.y * n.x);
+}
+
+inline OBB toOBB(const AABB& a) {
+    return {(a.min + a.max) * 0.5f, {1.0f, 0.0f}, (a.max - a.min) * 0.5f};
+}
+
+// A rectangle only has two distinct edge directions, so two boxes need four axes instead of eight
+inline bool overlaps(const OBB& a, const OBB& b) {
+    vector2 d = b.center - a.center;
+    const vector2 axes[4] = {a.axis, {-a.axis.y, a.axis.x}, b.axis, {-b.axis.y, b.axis.x}};
+    for (const vector2& n : axes) {
+        if (std::fabs(d.dot(n)) > projectedRadius(a, n) + projectedRadius(b, n)) return false;
+    }
+    return true;
+}
+
+inline bool overlaps(const AABB& a, const OBB& b) {
+    return overlaps(toOBB(a), b);
+}
+
+/*
+ * Continuous tests: the first shape moves by delta over t in [0, 1] and toi is the first t where it touches the
+ * second. Shapes that already overlap at t = 0 hit with toi = 0. For two moving shapes pass the difference of their
+ * deltas.
+ */
+
+// Swept SAT. On each axis the gap closes at one time and opens again at a later one, the boxes touch from the
+// latest close to the earliest open
+inline bool sweep(const OBB& a, vector2 delta, const OBB& b, float& toi) {
+    vector2 d = b.center - a.center;
+    const vector2 axes[4] = {a.axis, {-a.axis.y, a.axis.x}, b.axis, {-b.axis.y, b.axis.x}};
+    float enter = 0.0f;
+    float exit = 1.0f;
+    for (const vector2& n : axes) {
+        float r = projectedRadius(a, n) + projectedRadius(b, n);
+        float s = d.dot(n);
+        float v = delta.dot(n);
+        if (std::fabs(v) < 1e-9f) {
+            if (std::fabs(s) > r) return false; // never closes on this axis
+            continue;
+        }
+        float t0 = (s - r) / v;
+        float t1 = (s + r) / v;
+        if (t0 > t1) std::swap(t0, t1);
+        enter = std::fmax(enter, t0);
+        exit = std::fmin(exit, t1);
+        if (enter > exit) return false;
+    }
+    toi = enter;
+    return true;
+}
+
+inline bool sweep(const AABB& a, vector2 delta, const OBB& b, float& toi) {
+    return sweep(toOBB(a), delta, b, toi);
+}
+
+// Segment v1-v2 against segment v3-v4, ua is how far along v1-v2 they cross. The math behind doLinesIntercept
+inline bool segmentIntercept(vector2 v1, vector2 v2, vector2 v3, vector2 v4, float& ua) {
+    float d = (v4.y - v3.y) * (v2.x - v1.x) - (v4.x - v3.x) * (v2.y - v1.y);
+    if (d == 0) return false; // parallel
+    float n_a = (v4.x - v3.x) * (v1.y - v3.y) - (v4.y - v3.y) * (v1.x - v3.x);
+    float n_b = (v2.x - v1.x) * (v1.y - v3.y) - (v2.y - v1.y) * (v1.x - v3.x);
+    float ub = n_b / d;
+    ua = n_a / d;
+    return ua >= 0 && ua <= 1 && ub >= 0 && ub <= 1;
+}
+
+// Where from-to first enters box, as a fraction of the way. A segment starting inside the box never enters it,
+// so a laser mounted on a wall shines out of it
+inline bool segmentEnters(const OBB& box, vector2 from, vector2 to, float& fraction) {
+    if (box.contains(from)) return false;
+    Quad q = box.corners();
+    bool hit = false;
+    for (int i = 0; i < 4; i++) {
+        float ua;
+        if (segmentIntercept(from, to, q.p[i], q.p[(i + 1) & 3], ua) && (!hit || ua < fraction)) {
+            fraction = ua;
+            hit = true;
+        }
+    }
+    return hit;
+}
+
+inline bool sweepCircle(vector2 a, float radiusA, vector2 delta, vector2 b, float radiusB, float& toi) {
+    vector2 m = a - b;
+    float r = radiusA + radiusB;
+    float c = m.dot(m) - r * r;
+    if (c <= 0.0f) {
+        toi = 0.0f;
+        return true;
+    }
+    float dd = delta.dot(delta);
+    float md = m.dot(delta);
+    if (dd <= 0.0f || md >= 0.0f) return false; // still or moving apart
+    float disc = md * md - dd * c;
+    if (disc < 0.0f) return false;
+    float t = (-md - std::sqrt(disc)) / dd;
+    if (t > 1.0f) return false;
+    toi = t;
+    return true;
+}
+
+#endif //CSCI437_GEOMETRY_H
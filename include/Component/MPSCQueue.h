@@ -0,0 +1,95 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Peter Greek
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * Proper permission is grated by the copyright holder.
+ *
+ * Credit is attributed to the copyright holder in some form in the product.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+//
+// Created by xerxe on 10/18/2026.
+//
+
+#ifndef CSCI437_MPSCQUEUE_H
+#define CSCI437_MPSCQUEUE_H
+
+#include <atomic>
+#include <utility>
+
+/*
+ * Lock-free multi producer, single consumer queue (Dmitry Vyukov's intrusive MPSC design).
+ * push() can be called from any thread, pop() only from the one consumer thread. A push that is halfway done can
+ * hide the items behind it for a moment, pop() then reports empty and they show up on the next pop.
+ */
+template <typename T>
+class MPSCQueue {
+public:
+    MPSCQueue() {
+        Node* stub = new Node();
+        head.store(stub, std::memory_order_relaxed);
+        tail = stub;
+    }
+
+    ~MPSCQueue() {
+        T discard;
+        while (pop(discard)) {}
+        delete tail;
+    }
+
+    MPSCQueue(const MPSCQueue&) = delete;
+    MPSCQueue& operator=(const MPSCQueue&) = delete;
+
+    void push(T value) {
+        Node* node = new Node(std::move(value));
+        Node* prev = head.exchange(node, std::memory_order_acq_rel);
+        prev->next.store(node, std::memory_order_release);
+    }
+
+    bool pop(T& out) {
+        Node* next = tail->next.load(std::memory_order_acquire);
+        if (next == nullptr) return false;
+        out = std::move(next->value);
+        delete tail;
+        tail = next; // next is the new stub, its value has been moved out
+        return true;
+    }
+
+    [[nodiscard]] bool empty() const {
+        return tail->next.load(std::memory_order_acquire) == nullptr;
+    }
+
+private:
+    struct Node {
+        std::atomic<Node*> next{nullptr};
+        T value{};
+
+        Node() = default;
+        explicit Node(T v) : value(std::move(v)) {}
+    };
+
+    std::atomic<Node*> head;
+    Node* tail;
+};
+
+#endif //CSCI437_MPSCQUEUE_H
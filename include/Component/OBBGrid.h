@@ -0,0 +1,302 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Peter Greek
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * Proper permission is grated by the copyright holder.
+ *
+ * Credit is attributed to the copyright holder in some form in the product.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+
+//
+// Created by xerxe on 10/18/2026.
+//
+
+#ifndef CSCI437_OBBGRID_H
+#define CSCI437_OBBGRID_H
+
+#include "CollisionKernels.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <unordered_map>
+
+/*
+ * Hashed uniform grid of static OBBs (walls). Unlike SpatialHash each cell keeps its boxes packed in an OBBBatch,
+ * so a query runs the batch kernels over the cell instead of chasing pointers to every wall. A box is copied into
+ * each cell its bounds touch; boxes spanning more than LARGE_SPAN cells go in one side batch that every query tests.
+ */
+class OBBGrid {
+public:
+    static constexpr uint32_t INVALID = UINT32_MAX;
+
+    explicit OBBGrid(float cellSize = 128.0f) : cellSize(cellSize), inverseCell(1.0f / cellSize) {}
+
+    uint32_t insert(const OBB& box) {
+        uint32_t id;
+        if (!freeIds.empty()) {
+            id = freeIds.back();
+            freeIds.pop_back();
+        } else {
+            id = static_cast<uint32_t>(entries.size());
+            entries.emplace_back();
+        }
+        Entry& entry = entries[id];
+        entry.box = box;
+        entry.alive = true;
+        cellRange(box.bounds(), entry.range);
+        if (isLarge(entry.range)) {
+            large.push(box, id);
+        } else {
+            for (int cy = entry.range[1]; cy <= entry.range[3]; cy++) {
+                for (int cx = entry.range[0]; cx <= entry.range[2]; cx++) {
+                    cells[key(cx, cy)].push(box, id);
+                }
+            }
+        }
+        alive++;
+        return id;
+    }
+
+    void remove(uint32_t id) {
+        if (id >= entries.size() || !entries[id].alive) return;
+        const int* range = entries[id].range;
+        if (isLarge(range)) {
+            erase(large, id);
+        } else {
+            for (int cy = range[1]; cy <= range[3]; cy++) {
+                for (int cx = range[0]; cx <= range[2]; cx++) {
+                    auto it = cells.find(key(cx, cy));
+                    if (it != cells.end()) erase(it->second, id);
+                }
+            }
+        }
+        entries[id].alive = false;
+        freeIds.push_back(id);
+        alive--;
+    }
+
+    void clear() {
+        entries.clear();
+        freeIds.clear();
+        cells.clear();
+        large.clear();
+        alive = 0;
+    }
+
+    [[nodiscard]] const OBB& get(uint32_t id) const { return entries[id].box; }
+    [[nodiscard]] bool contains(uint32_t id) const { return id < entries.size() && entries[id].alive; }
+    [[nodiscard]] size_t size() const { return alive; }
+
+    // Id of a box overlapping box, INVALID if none
+    [[nodiscard]] uint32_t firstOverlapping(const AABB& box) const {
+        int range[4];
+        cellRange(box, range);
+        for (int cy = range[1]; cy <= range[3]; cy++) {
+            for (int cx = range[0]; cx <= range[2]; cx++) {
+                auto it = cells.find(key(cx, cy));
+                if (it == cells.end()) continue;
+                int row = firstOverlap(it->second, box);
+                if (row >= 0) return it->second.id[row];
+            }
+        }
+        int row = firstOverlap(large, box);
+        return row >= 0 ? large.id[row] : INVALID;
+    }
+
+    // Id of a box containing point, INVALID if none
+    [[nodiscard]] uint32_t firstContaining(vector2 point) const {
+        auto it = cells.find(key(cellOf(point.x), cellOf(point.y)));
+        if (it != cells.end()) {
+            int row = ::firstContaining(it->second, point);
+            if (row >= 0) return it->second.id[row];
+        }
+        int row = ::firstContaining(large, point);
+        return row >= 0 ? large.id[row] : INVALID;
+    }
+
+    // Earliest box that box hits moving by delta, see sweep() in Geometry.h. Only the cells under the swept bounds
+    // are visited, so a fast mover costs a longer strip of cells rather than more steps
+    uint32_t firstSwept(const AABB& box, vector2 delta, float& toi) {
+        AABB swept = {{std::fmin(box.min.x, box.min.x + delta.x), std::fmin(box.min.y, box.min.y + delta.y)},
+                      {std::fmax(box.max.x, box.max.x + delta.x), std::fmax(box.max.y, box.max.y + delta.y)}};
+        candidates.clear();
+        queryAABB(swept, candidates);
+        uint32_t first = INVALID;
+        toi = 1.0f;
+        for (uint32_t id : candidates) {
+            float t;
+            if (sweep(box, delta, entries[id].box, t) && (first == INVALID || t < toi)) {
+                first = id;
+                toi = t;
+            }
+        }
+        return first;
+    }
+
+    // First box the segment from-to enters, see segmentEnters() in Geometry.h. Walks the cells along the segment in
+    // order and stops at the first cell that ends past a hit, so a short ray or one that hits early stays cheap
+    uint32_t firstOnSegment(vector2 from, vector2 to, float& fraction) {
+        stamp++;
+        uint32_t first = INVALID;
+        fraction = 1.0f;
+        for (uint32_t id : large.id) testSegment(id, from, to, first, fraction);
+
+        const float inf = std::numeric_limits<float>::infinity();
+        vector2 d = to - from;
+        int cx = cellOf(from.x), cy = cellOf(from.y);
+        const int endX = cellOf(to.x), endY = cellOf(to.y);
+        const int stepX = d.x > 0 ? 1 : -1, stepY = d.y > 0 ? 1 : -1;
+        const float deltaX = d.x != 0 ? cellSize / std::fabs(d.x) : inf;
+        const float deltaY = d.y != 0 ? cellSize / std::fabs(d.y) : inf;
+        float nextX = d.x != 0 ? ((static_cast<float>(cx + (d.x > 0)) * cellSize) - from.x) / d.x : inf;
+        float nextY = d.y != 0 ? ((static_cast<float>(cy + (d.y > 0)) * cellSize) - from.y) / d.y : inf;
+        for (;;) {
+            auto it = cells.find(key(cx, cy));
+            if (it != cells.end()) {
+                for (uint32_t id : it->second.id) testSegment(id, from, to, first, fraction);
+            }
+            float cellExit = std::fmin(nextX, nextY);
+            if (fraction <= cellExit || cellExit > 1.0f || (cx == endX && cy == endY)) break;
+            if (nextX < nextY) {
+                cx += stepX;
+                nextX += deltaX;
+            } else {
+                cy += stepY;
+                nextY += deltaY;
+            }
+        }
+        return first;
+    }
+
+    // fraction[i] = firstOnSegment(from[i], to[i]), 1 where nothing is hit. Segments near each other (enemies
+    // around the player, the lasers in a room) share one broad phase; a spread out batch walks each one instead
+    void segmentsFirstHit(const vector2* from, const vector2* to, size_t count, float* fraction) {
+        if (count == 0) return;
+        AABB all = {from[0], from[0]};
+        for (size_t i = 0; i < count; i++) {
+            for (vector2 p : {from[i], to[i]}) {
+                all.min = {std::fmin(all.min.x, p.x), std::fmin(all.min.y, p.y)};
+                all.max = {std::fmax(all.max.x, p.x), std::fmax(all.max.y, p.y)};
+            }
+        }
+        int range[4];
+        cellRange(all, range);
+        if (isLarge(range)) {
+            for (size_t i = 0; i < count; i++) firstOnSegment(from[i], to[i], fraction[i]);
+            return;
+        }
+
+        candidates.clear();
+        queryAABB(all, candidates);
+        for (size_t i = 0; i < count; i++) {
+            AABB bounds = {{std::fmin(from[i].x, to[i].x), std::fmin(from[i].y, to[i].y)},
+                           {std::fmax(from[i].x, to[i].x), std::fmax(from[i].y, to[i].y)}};
+            fraction[i] = 1.0f;
+            for (uint32_t id : candidates) {
+                const OBB& box = entries[id].box;
+                float t;
+                if (box.bounds().overlaps(bounds) && segmentEnters(box, from[i], to[i], t) && t < fraction[i]) {
+                    fraction[i] = t;
+                }
+            }
+        }
+    }
+
+    // Ids of every box whose bounds overlap box, each once. Narrow phase is up to the caller
+    void queryAABB(const AABB& box, std::vector<uint32_t>& out) {
+        stamp++;
+        int range[4];
+        cellRange(box, range);
+        for (int cy = range[1]; cy <= range[3]; cy++) {
+            for (int cx = range[0]; cx <= range[2]; cx++) {
+                auto it = cells.find(key(cx, cy));
+                if (it == cells.end()) continue;
+                for (uint32_t id : it->second.id) visit(id, box, out);
+            }
+        }
+        for (uint32_t id : large.id) visit(id, box, out);
+    }
+
+private:
+    static constexpr int LARGE_SPAN = 16;
+
+    struct Entry {
+        OBB box;
+        int range[4] = {0, 0, -1, -1}; // min cell x, y, max cell x, y
+        uint32_t stamp = 0;
+        bool alive = false;
+    };
+
+    float cellSize;
+    float inverseCell;
+    std::vector<Entry> entries;
+    std::vector<uint32_t> freeIds;
+    std::unordered_map<uint64_t, OBBBatch> cells;
+    OBBBatch large;
+    std::vector<uint32_t> candidates;
+    uint32_t stamp = 0;
+    size_t alive = 0;
+
+    static uint64_t key(int cx, int cy) {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(cx)) << 32) | static_cast<uint32_t>(cy);
+    }
+
+    [[nodiscard]] int cellOf(float v) const { return static_cast<int>(std::floor(v * inverseCell)); }
+
+    void cellRange(const AABB& box, int* range) const {
+        range[0] = cellOf(box.min.x);
+        range[1] = cellOf(box.min.y);
+        range[2] = cellOf(box.max.x);
+        range[3] = cellOf(box.max.y);
+    }
+
+    static bool isLarge(const int* range) {
+        return range[2] - range[0] >= LARGE_SPAN || range[3] - range[1] >= LARGE_SPAN;
+    }
+
+    static void erase(OBBBatch& batch, uint32_t id) {
+        auto it = std::find(batch.id.begin(), batch.id.end(), id);
+        if (it != batch.id.end()) batch.removeAt(it - batch.id.begin());
+    }
+
+    void testSegment(uint32_t id, vector2 from, vector2 to, uint32_t& first, float& fraction) {
+        Entry& entry = entries[id];
+        if (entry.stamp == stamp) return;
+        entry.stamp = stamp;
+        float t;
+        if (segmentEnters(entry.box, from, to, t) && (first == INVALID || t < fraction)) {
+            first = id;
+            fraction = t;
+        }
+    }
+
+    void visit(uint32_t id, const AABB& box, std::vector<uint32_t>& out) {
+        Entry& entry = entries[id];
+        if (entry.stamp == stamp) return;
+        entry.stamp = stamp;
+        if (entry.box.bounds().overlaps(box)) out.push_back(id);
+    }
+};
+
+#endif //CSCI437_OBBGRID_H
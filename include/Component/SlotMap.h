@@ -0,0 +1,145 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Peter Greek
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * Proper permission is grated by the copyright holder.
+ *
+ * Credit is attributed to the copyright holder in some form in the product.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+//
+// Created by xerxe on 10/18/2026.
+//
+
+#ifndef CSCI437_SLOTMAP_H
+#define CSCI437_SLOTMAP_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <utility>
+
+// Stable reference into a SlotMap. The generation changes every time a slot is reused, so a handle to something
+// that was removed stops resolving instead of pointing at whatever took its place.
+struct SlotHandle {
+    uint32_t index = UINT32_MAX;
+    uint32_t generation = 0;
+
+    [[nodiscard]] bool valid() const { return index != UINT32_MAX; }
+
+    // generation in the high half, index in the low half
+    [[nodiscard]] uint64_t pack() const { return (static_cast<uint64_t>(generation) << 32) | index; }
+    static SlotHandle unpack(uint64_t packed) {
+        return {static_cast<uint32_t>(packed & 0xFFFFFFFFu), static_cast<uint32_t>(packed >> 32)};
+    }
+    bool operator==(const SlotHandle& other) const { return index == other.index && generation == other.generation; }
+    bool operator!=(const SlotHandle& other) const { return !(*this == other); }
+};
+
+/*
+ * Generational slot map. Values live packed in one vector so iterating is a linear walk, handles go through a
+ * sparse slot table to find them. Insert and remove are O(1); remove moves the last value into the hole
+ * (swap and pop), so iteration order is not insertion order.
+ */
+template <typename T>
+class SlotMap {
+public:
+    SlotHandle insert(T value) {
+        uint32_t slotIndex;
+        if (!freeSlots.empty()) {
+            slotIndex = freeSlots.back();
+            freeSlots.pop_back();
+        } else {
+            slotIndex = static_cast<uint32_t>(slots.size());
+            slots.push_back({0, 0});
+        }
+
+        slots[slotIndex].denseIndex = static_cast<uint32_t>(values.size());
+        values.push_back(std::move(value));
+        denseToSlot.push_back(slotIndex);
+        return {slotIndex, slots[slotIndex].generation};
+    }
+
+    bool remove(SlotHandle handle) {
+        if (!contains(handle)) return false;
+        removeAt(slots[handle.index].denseIndex);
+        return true;
+    }
+
+    // Remove by position in the packed array, the value from the back now sits at denseIndex
+    void removeAt(size_t denseIndex) {
+        uint32_t slotIndex = denseToSlot[denseIndex];
+        size_t last = values.size() - 1;
+        if (denseIndex != last) {
+            values[denseIndex] = std::move(values[last]);
+            denseToSlot[denseIndex] = denseToSlot[last];
+            slots[denseToSlot[denseIndex]].denseIndex = static_cast<uint32_t>(denseIndex);
+        }
+        values.pop_back();
+        denseToSlot.pop_back();
+
+        slots[slotIndex].generation++;
+        freeSlots.push_back(slotIndex);
+    }
+
+    [[nodiscard]] bool contains(SlotHandle handle) const {
+        return handle.index < slots.size() && slots[handle.index].generation == handle.generation;
+    }
+
+    T* get(SlotHandle handle) {
+        return contains(handle) ? &values[slots[handle.index].denseIndex] : nullptr;
+    }
+
+    [[nodiscard]] SlotHandle handleAt(size_t denseIndex) const {
+        uint32_t slotIndex = denseToSlot[denseIndex];
+        return {slotIndex, slots[slotIndex].generation};
+    }
+
+    void clear() {
+        for (size_t i = values.size(); i > 0; i--) {
+            removeAt(i - 1);
+        }
+    }
+
+    T& operator[](size_t denseIndex) { return values[denseIndex]; }
+    [[nodiscard]] size_t size() const { return values.size(); }
+    [[nodiscard]] bool empty() const { return values.empty(); }
+
+    auto begin() { return values.begin(); }
+    auto end() { return values.end(); }
+    auto begin() const { return values.begin(); }
+    auto end() const { return values.end(); }
+
+private:
+    struct Slot {
+        uint32_t denseIndex;
+        uint32_t generation;
+    };
+
+    std::vector<T> values;
+    std::vector<uint32_t> denseToSlot;
+    std::vector<Slot> slots;
+    std::vector<uint32_t> freeSlots;
+};
+
+#endif //CSCI437_SLOTMAP_H
@@ -0,0 +1,220 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Peter Greek
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * Proper permission is grated by the copyright holder.
+ *
+ * Credit is attributed to the copyright holder in some form in the product.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+//
+// Created by xerxe on 10/18/2026.
+//
+
+#ifndef CSCI437_SPATIALHASH_H
+#define CSCI437_SPATIALHASH_H
+
+#include "vector2.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+/*
+ * Uniform grid over world space, hashed so it doesn't need world bounds. Each item is an AABB and is listed in
+ * every cell it touches; move() only touches the cell lists when the covered cell range changes, so an entity
+ * drifting inside its cells costs a compare. Items wider than LARGE_SPAN cells (long lasers) go in a side list that
+ * every query checks, instead of being written into hundreds of cells.
+ *
+ * Queries append ids to a caller owned vector, each id at most once, so the caller can attach or remove items
+ * while it walks the results.
+ */
+template <typename T>
+class SpatialHash {
+public:
+    static constexpr uint32_t INVALID = UINT32_MAX;
+
+    explicit SpatialHash(float cellSize = 64.0f) : cellSize(cellSize), inverseCell(1.0f / cellSize) {}
+
+    uint32_t insert(T value, vector2 min, vector2 max) {
+        uint32_t id;
+        if (!freeIds.empty()) {
+            id = freeIds.back();
+            freeIds.pop_back();
+        } else {
+            id = static_cast<uint32_t>(items.size());
+            items.emplace_back();
+        }
+        Item& item = items[id];
+        item.value = std::move(value);
+        item.alive = true;
+        item.min = min;
+        item.max = max;
+        cellRange(min, max, item.range);
+        link(id);
+        alive++;
+        return id;
+    }
+
+    void move(uint32_t id, vector2 min, vector2 max) {
+        Item& item = items[id];
+        item.min = min;
+        item.max = max;
+        int range[4];
+        cellRange(min, max, range);
+        if (std::equal(range, range + 4, item.range)) return;
+        unlink(id);
+        std::copy(range, range + 4, item.range);
+        link(id);
+    }
+
+    void remove(uint32_t id) {
+        if (id >= items.size() || !items[id].alive) return;
+        unlink(id);
+        items[id].alive = false;
+        items[id].value = T();
+        freeIds.push_back(id);
+        alive--;
+    }
+
+    void clear() {
+        items.clear();
+        freeIds.clear();
+        cells.clear();
+        large.clear();
+        alive = 0;
+    }
+
+    T& get(uint32_t id) { return items[id].value; }
+    [[nodiscard]] bool contains(uint32_t id) const { return id < items.size() && items[id].alive; }
+    [[nodiscard]] size_t size() const { return alive; }
+
+    // Every item whose box overlaps [min, max]
+    void queryAABB(vector2 min, vector2 max, std::vector<uint32_t>& out) {
+        stamp++;
+        int range[4];
+        cellRange(min, max, range);
+        for (int cy = range[1]; cy <= range[3]; cy++) {
+            for (int cx = range[0]; cx <= range[2]; cx++) {
+                auto it = cells.find(key(cx, cy));
+                if (it == cells.end()) continue;
+                for (uint32_t id : it->second) visit(id, min, max, out);
+            }
+        }
+        for (uint32_t id : large) visit(id, min, max, out);
+    }
+
+    // Every item whose box comes within radius of center
+    void queryRadius(vector2 center, float radius, std::vector<uint32_t>& out) {
+        size_t first = out.size();
+        queryAABB(center - vector2(radius, radius), center + vector2(radius, radius), out);
+        float r2 = radius * radius;
+        out.erase(std::remove_if(out.begin() + first, out.end(), [&](uint32_t id) {
+            const Item& item = items[id];
+            float dx = center.x - std::clamp(center.x, item.min.x, item.max.x);
+            float dy = center.y - std::clamp(center.y, item.min.y, item.max.y);
+            return dx * dx + dy * dy > r2;
+        }), out.end());
+    }
+
+private:
+    static constexpr int LARGE_SPAN = 16;
+
+    struct Item {
+        T value{};
+        vector2 min;
+        vector2 max;
+        int range[4] = {0, 0, -1, -1}; // min cell x, y, max cell x, y
+        uint32_t stamp = 0;
+        bool alive = false;
+    };
+
+    float cellSize;
+    float inverseCell;
+    std::vector<Item> items;
+    std::vector<uint32_t> freeIds;
+    std::unordered_map<uint64_t, std::vector<uint32_t>> cells;
+    std::vector<uint32_t> large;
+    uint32_t stamp = 0;
+    size_t alive = 0;
+
+    static uint64_t key(int cx, int cy) {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(cx)) << 32) | static_cast<uint32_t>(cy);
+    }
+
+    void cellRange(vector2 min, vector2 max, int* range) const {
+        range[0] = static_cast<int>(std::floor(min.x * inverseCell));
+        range[1] = static_cast<int>(std::floor(min.y * inverseCell));
+        range[2] = static_cast<int>(std::floor(max.x * inverseCell));
+        range[3] = static_cast<int>(std::floor(max.y * inverseCell));
+    }
+
+    static bool isLarge(const int* range) {
+        return range[2] - range[0] >= LARGE_SPAN || range[3] - range[1] >= LARGE_SPAN;
+    }
+
+    void link(uint32_t id) {
+        const int* range = items[id].range;
+        if (isLarge(range)) {
+            large.push_back(id);
+            return;
+        }
+        for (int cy = range[1]; cy <= range[3]; cy++) {
+            for (int cx = range[0]; cx <= range[2]; cx++) {
+                cells[key(cx, cy)].push_back(id);
+            }
+        }
+    }
+
+    static void erase(std::vector<uint32_t>& list, uint32_t id) {
+        auto it = std::find(list.begin(), list.end(), id);
+        if (it == list.end()) return;
+        *it = list.back();
+        list.pop_back();
+    }
+
+    void unlink(uint32_t id) {
+        const int* range = items[id].range;
+        if (isLarge(range)) {
+            erase(large, id);
+            return;
+        }
+        for (int cy = range[1]; cy <= range[3]; cy++) {
+            for (int cx = range[0]; cx <= range[2]; cx++) {
+                auto it = cells.find(key(cx, cy));
+                if (it != cells.end()) erase(it->second, id);
+            }
+        }
+    }
+
+    void visit(uint32_t id, vector2 min, vector2 max, std::vector<uint32_t>& out) {
+        Item& item = items[id];
+        if (item.stamp == stamp) return;
+        item.stamp = stamp;
+        if (item.max.x < min.x || item.min.x > max.x || item.max.y < min.y || item.min.y > max.y) return;
+        out.push_back(id);
+    }
+};
+
+#endif //CSCI437_SPATIALHASH_H
@@ -0,0 +1,82 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Peter Greek
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * Proper permission is grated by the copyright holder.
+ *
+ * Credit is attributed to the copyright holder in some form in the product.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+
+//
+// Created by xerxe on 10/18/2026.
+//
+
+#ifndef CSCI437_TRIGTABLE_H
+#define CSCI437_TRIGTABLE_H
+
+#include "vector2.h"
+#include "heading.h"
+#include <array>
+
+/*
+ * sin and cos of every whole degree, 0 to 360 inclusive so any Heading indexes them directly. Built at compile
+ * time: std::sin isn't constexpr, so each entry is folded into 0-90 degrees and summed as a Taylor series in
+ * double, which also makes the quarter turns exact (sin 180 is 0, not -8.7e-8 like the float std::sin).
+ */
+constexpr double taylorSin(double x) {
+    double term = x;
+    double sum = x;
+    for (int n = 1; n < 12; n++) {
+        term *= -x * x / ((2 * n) * (2 * n + 1));
+        sum += term;
+    }
+    return sum;
+}
+
+constexpr double sinDegrees(int degrees) {
+    if (degrees > 180) return -sinDegrees(degrees - 180);
+    if (degrees > 90) return sinDegrees(180 - degrees);
+    return taylorSin(degrees * 3.14159265358979323846 / 180.0);
+}
+
+inline constexpr std::array<float, 361> SIN_TABLE = [] {
+    std::array<float, 361> t{};
+    for (int i = 0; i <= 360; i++) t[i] = static_cast<float>(sinDegrees(i));
+    return t;
+}();
+
+inline constexpr std::array<float, 361> COS_TABLE = [] {
+    std::array<float, 361> t{};
+    for (int i = 0; i <= 360; i++) t[i] = static_cast<float>(sinDegrees((i + 90) % 360));
+    return t;
+}();
+
+static_assert(SIN_TABLE[90] == 1.0f && SIN_TABLE[180] == 0.0f && COS_TABLE[360] == 1.0f && COS_TABLE[270] == 0.0f);
+
+// Unit vector for a heading, two table loads
+inline vector2 angleToVector2(Heading angle) {
+    return {COS_TABLE[angle.get()], SIN_TABLE[angle.get()]};
+}
+
+#endif //CSCI437_TRIGTABLE_H
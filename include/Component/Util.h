@@ -42,12 +42,15 @@
 
 #include <nlohmann/json.hpp>
 #include "vector2.h"
+#include "Geometry.h"
 #include "heading.h"
+#include "TrigTable.h"
 #include "config.h"
+#include "EventId.h"
 
 using json = nlohmann::json;
-using UUID_t = std::string;
-using passFunc_t = std::function<void(const std::string& eventName, const json& eventData)>;
+using ProcessId_t = uint64_t; // packed ProcessManager slot handle, see SlotHandle::pack
+using passFunc_t = std::function<void(EventId eventId, const json& eventData)>;
 using vectorList_t = std::vector<vector2>;
 using sList_t = std::vector<std::string>;
 
@@ -97,8 +100,7 @@ inline void from_json(const json &j, vector2 &s)
 // Vector and Heading Functions
 Heading getHeadingFromVector(const vector2& v);
 Heading getHeadingFromVectors(const vector2& v1, const vector2& v2);
-vector2 angleToVector2(float angle);
-vector2 angleToVector2(Heading angle);
+vector2 angleToVector2(float angle); // fractional degrees, the Heading overload is in TrigTable.h
 vectorList_t calculateBoundingBox(const vector2& min, const vector2& max);
 std::pair<float, float> calculateDimensions(const std::vector<vector2>& points);
 bool isPointInBounds(const vector2& point, const vectorList_t& polygon);
@@ -116,6 +118,7 @@ vector2 random(vector2 minVec, vector2 maxVec);
 sList_t split(const std::string& str, const std::string& delimiter);
 
 uint32_t jenkinsOneAtATimeHash(const std::string& key);
+std::string formatProcessId(ProcessId_t id);
 int mapHashToRange(uint32_t hash, int min, int max);
 
 float pHeight(float num);
@@ -38,8 +38,10 @@
 // Declare global variables with extern
 extern bool unlimitedFrames;
 extern int debugMode;
+extern bool headlessMode; // --headless: dummy SDL drivers, no drawing, uncapped fixed-step simulation
 extern int curRoomIndex;
 extern int targetFPS;
+extern int simulationRate; // fixed simulation steps per second
 
 extern int BASE_SCREEN_WIDTH;
 extern int BASE_SCREEN_HEIGHT;
@@ -34,6 +34,7 @@
 #ifndef CSCI437_HEADING_H
 #define CSCI437_HEADING_H
 
+#include <cstdint>
 #include <iostream>
 
 // Heading Class
@@ -94,12 +95,47 @@ public:
     }
 };
 
-// Specialization for heading (0-360)
-class Heading : public BoundedInt {
+// Whole degrees 0-360, wrapping like BoundedInt(v, 0, 360) does (361 steps, so 360 and 0 are both kept). Headings
+// are stored on every wall and laser and copied around a lot, so it keeps just the value in 16 bits instead of a
+// BoundedInt's value, min and max
+class Heading {
+private:
+    static constexpr int STEPS = 361;
+    int16_t value = 0;
+
+    static constexpr int16_t wrap(int v) {
+        v %= STEPS;
+        return static_cast<int16_t>(v < 0 ? v + STEPS : v);
+    }
 public:
-    explicit Heading(int v = 0) : BoundedInt(v, 0, 360) {}
-    // keep the default constructor
-    Heading() : BoundedInt(0, 0, 360) {}
+    constexpr explicit Heading(int v = 0) : value(wrap(v)) {}
+
+    [[nodiscard]] constexpr int get() const { return value; }
+    constexpr void set(int v) { value = wrap(v); }
+
+    Heading& operator=(int v) {
+        set(v);
+        return *this;
+    }
+
+    Heading& operator+=(int v) {
+        set(value + v);
+        return *this;
+    }
+
+    Heading& operator-=(int v) {
+        set(value - v);
+        return *this;
+    }
+
+    friend constexpr Heading operator+(Heading h, int v) { return Heading(h.value + v); }
+    friend constexpr Heading operator-(Heading h, int v) { return Heading(h.value - v); }
+    friend constexpr bool operator==(Heading a, Heading b) { return a.value == b.value; }
+
+    friend std::ostream& operator<<(std::ostream& os, const Heading& h) {
+        os << h.value;
+        return os;
+    }
 
     bool isWithin(int a1, int a2) const {
         // check if the current heading is within the range of angles
@@ -0,0 +1,64 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Peter Greek
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * Proper permission is grated by the copyright holder.
+ *
+ * Credit is attributed to the copyright holder in some form in the product.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+//
+// Created by xerxe on 10/18/2026.
+//
+
+#ifndef CSCI437_BENCHMARK_H
+#define CSCI437_BENCHMARK_H
+
+#include "xProcess.h"
+#include <string>
+
+// Debug process that registers the bench* chat commands. Every benchmark builds its own scratch state, so they
+// can be run from the chat box at any time without touching the running game.
+class Benchmark : public xProcess {
+public:
+    explicit Benchmark(passFunc_t func) : xProcess(false, std::move(func)) { setDormant(true); }
+
+    int initialize() override;
+    void update(float deltaMs) override {}
+    bool isDone() override { return false; }
+
+private:
+    void report(const std::string& line);
+    bool countArg(const sList_t& args, size_t index, int fallback, int max, int& out, const std::string& usage);
+
+    void benchEventDispatch();
+    void benchPostQueue(int producers, int perProducer);
+    void benchParallelUpdate();
+    void benchTimers(int count);
+    void benchSpatialHash();
+    void benchGeometry(int count);
+    void benchCollisionKernels(int walls);
+    void benchTrig(int count);
+};
+
+#endif //CSCI437_BENCHMARK_H
@@ -29,7 +29,7 @@
 #define CSCI437_EVENTMANAGER_H
 
 #include <iostream>
-#include <map>
+#include <unordered_map>
 #include <string>
 #include <memory>
 #include <vector>
@@ -38,63 +38,143 @@
 #include <tuple>
 #include <nlohmann/json.hpp>
 #include "Util.h"
+#include "EventQueue.h"
+#include "EventProfiler.h"
 #include <list>
 
 using json = nlohmann::json;
 
+template <typename Event>
+class EventChannel;
+
 class EventManager {
 public:
-    explicit EventManager(std::function<void(const std::string&, const json&)> func)
+    using handlerList_t = std::list<std::function<void(const json&)>>;
+
+    explicit EventManager(passFunc_t func)
             : pgx_onTriggerEvent(std::move(func)) {}
 
-    ~EventManager() {
-        for (auto& [eventName, handlers] : eventHandlers) {
+    virtual ~EventManager() {
+        for (auto& unsubscribe : typedChannels) {
+            unsubscribe(this); // Drop this manager's typed handlers
+        }
+        typedChannels.clear();
+
+        for (auto& [eventId, handlers] : eventHandlers) {
             handlers.clear(); // Clear the list of handlers
         }
         eventHandlers.clear(); // Clear the map
     };
 
+    // Typed handlers are skipped while this returns false (xProcess stops listening once dead)
+    [[nodiscard]] virtual bool acceptsEvents() const { return true; }
+
     // Function wrapper for any callable with variadic args
     template <typename Func>
-    void AddEventHandler(const std::string& eventName, Func&& func) {
+    void AddEventHandler(EventId eventId, Func&& func) {
         using FunctionType = std::decay_t<Func>;
         using ArgsTuple = typename function_traits<FunctionType>::args_tuple;
 
-        eventHandlers[eventName].push_back([func = std::forward<Func>(func)](const json& eventData) {
+        handlersFor(eventId).push_back([func = std::forward<Func>(func)](const json& eventData) {
             callWithJson(func, eventData, ArgsTuple{});
         });
     }
 
     template <typename... Args>
-    void TriggerEvent(const std::string& eventName, Args&&... args) {
+    void TriggerEvent(EventId eventId, Args&&... args) {
         json eventData = packArguments(std::forward<Args>(args)...);
-        pgx_onTriggerEvent(eventName, eventData);
+        pgx_onTriggerEvent(eventId, eventData);
+    }
+
+    // Deferred version of TriggerEvent, delivered when the main loop flushes the given phase (see EventQueue.h)
+    template <typename... Args>
+    void QueueEvent(EventQueue::Phase phase, EventId eventId, Args&&... args) {
+        EventQueue::push(phase, eventId, packArguments(std::forward<Args>(args)...));
+    }
+
+    // Safe from any thread, delivered on the main thread at the start of the next frame
+    template <typename... Args>
+    void PostEvent(EventId eventId, Args&&... args) {
+        EventQueue::post(eventId, packArguments(std::forward<Args>(args)...));
     }
 
-    void onTriggerEvent(const std::string& eventName, const json& eventData) {
-        auto it = eventHandlers.find(eventName);
+    void onTriggerEvent(EventId eventId, const json& eventData) {
+        if constexpr (EventProfiler::enabled) EventProfiler::recordDispatch(eventId, eventData);
+
+        auto it = eventHandlers.find(eventId);
         if (it != eventHandlers.end()) {
             for (auto& handler : it->second) {
-                handler(eventData);
+                if constexpr (EventProfiler::enabled) {
+                    auto start = EventProfiler::clock_t::now();
+                    handler(eventData);
+                    EventProfiler::recordHandler(eventId, start);
+                } else {
+                    handler(eventData);
+                }
             }
         }
     }
 
+    // Typed events: the event is a plain struct, no json is built or parsed on dispatch
+    template <typename Event, typename Func>
+    void AddEventHandler(Func&& func) {
+        if (std::find(typedChannels.begin(), typedChannels.end(), &EventChannel<Event>::unsubscribe) == typedChannels.end()) {
+            typedChannels.push_back(&EventChannel<Event>::unsubscribe);
+        }
+        EventChannel<Event>::subscribe(this, std::forward<Func>(func));
+    }
+
+    template <typename Event, typename = std::enable_if_t<std::is_class_v<Event> && !std::is_convertible_v<const Event&, EventId>>>
+    void TriggerEvent(const Event& event) {
+        EventChannel<Event>::dispatch(event);
+    }
+
+    // The owning ProcessManager indexes processes by the events they listen to. The hook is told about every
+    // event this manager picks up a handler for, including the ones added before it was set. The handler list
+    // stays at the same address for the life of the manager, so the index can call it directly.
+    void setSubscribeHook(std::function<void(EventId, const handlerList_t*)> hook) {
+        subscribeHook = std::move(hook);
+        if (!subscribeHook) return;
+        for (auto& [eventId, handlers] : eventHandlers) {
+            subscribeHook(eventId, &handlers);
+        }
+    }
+
+    [[nodiscard]] std::vector<EventId> getSubscribedEvents() const {
+        std::vector<EventId> ids;
+        ids.reserve(eventHandlers.size());
+        for (auto& [eventId, handlers] : eventHandlers) {
+            ids.push_back(eventId);
+        }
+        return ids;
+    }
+
     template <typename Func>
     void RegisterCommand(const std::string& eventName, Func&& func) {
         print("Registering command: ", eventName);
         using FunctionType = std::decay_t<Func>;
         using ArgsTuple = typename function_traits<FunctionType>::args_tuple;
 
-        eventHandlers["__internal_command_" + eventName].push_back([func = std::forward<Func>(func)](const json& eventData) {
+        handlersFor(EventId::command(eventName)).push_back([func = std::forward<Func>(func)](const json& eventData) {
             callWithJson(func, eventData, ArgsTuple{});
         });
         TriggerEvent("__internal_chat_register_command", eventName);
     }
 
 private:
-    std::map<std::string, std::list<std::function<void(json)>> > eventHandlers;
-    std::function<void(const std::string&, const json&)> pgx_onTriggerEvent;
+    std::unordered_map<EventId, handlerList_t, EventIdHash> eventHandlers;
+    passFunc_t pgx_onTriggerEvent;
+    std::vector<void (*)(const EventManager*)> typedChannels;
+    std::function<void(EventId, const handlerList_t*)> subscribeHook;
+
+    handlerList_t& handlersFor(EventId eventId) {
+        auto [it, inserted] = eventHandlers.try_emplace(eventId);
+        if (inserted) {
+            EventId::registerName(eventId);
+            if (subscribeHook) subscribeHook(eventId, &it->second);
+        }
+        return it->second;
+    }
 
     // Converts variadic arguments into a JSON array
     template <typename... Args>
@@ -130,4 +210,64 @@ private:
     }
 };
 
+// One channel per event struct, shared by every EventManager. Handlers are kept in registration order and
+// stored as typed delegates, so dispatch is a straight walk over a vector. Main thread only.
+template <typename Event>
+class EventChannel {
+public:
+    using handler_t = std::function<void(const Event&)>;
+
+    static void subscribe(const EventManager* owner, handler_t handler) {
+        if (dispatchDepth > 0) {
+            // Can't grow the list while a handler is running from it, pick these up once dispatch unwinds
+            pending.push_back({owner, std::move(handler)});
+            return;
+        }
+        subscribers.push_back({owner, std::move(handler)});
+    }
+
+    static void unsubscribe(const EventManager* owner) {
+        auto match = [owner](const Subscriber& s) { return s.owner == owner; };
+        pending.erase(std::remove_if(pending.begin(), pending.end(), match), pending.end());
+        if (dispatchDepth > 0) {
+            for (auto& s : subscribers) {
+                if (s.owner == owner) s.owner = nullptr; // removed after dispatch
+            }
+            return;
+        }
+        subscribers.erase(std::remove_if(subscribers.begin(), subscribers.end(), match), subscribers.end());
+    }
+
+    static void dispatch(const Event& event) {
+        dispatchDepth++;
+        for (auto& s : subscribers) {
+            if (s.owner == nullptr || !s.owner->acceptsEvents()) continue;
+            s.handler(event);
+        }
+        dispatchDepth--;
+
+        if (dispatchDepth == 0) {
+            subscribers.erase(std::remove_if(subscribers.begin(), subscribers.end(),
+                                             [](const Subscriber& s) { return s.owner == nullptr; }),
+                              subscribers.end());
+            for (auto& s : pending) {
+                subscribers.push_back(std::move(s));
+            }
+            pending.clear();
+        }
+    }
+
+    [[nodiscard]] static size_t subscriberCount() { return subscribers.size(); }
+
+private:
+    struct Subscriber {
+        const EventManager* owner;
+        handler_t handler;
+    };
+
+    static inline std::vector<Subscriber> subscribers;
+    static inline std::vector<Subscriber> pending;
+    static inline int dispatchDepth = 0;
+};
+
 #endif //CSCI437_EVENTMANAGER_H
@@ -0,0 +1,80 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Peter Greek
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * Proper permission is grated by the copyright holder.
+ *
+ * Credit is attributed to the copyright holder in some form in the product.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+//
+// Created by xerxe on 10/18/2026.
+//
+
+#ifndef CSCI437_EVENTPROFILER_H
+#define CSCI437_EVENTPROFILER_H
+
+#include "Util.h"
+#include <chrono>
+#include <string>
+#include <vector>
+
+/*
+ * Per event stats for the json event bus. Only collected when built with -DUFO_PROFILE_EVENTS=ON, otherwise the
+ * record calls are compiled out by the `if constexpr (EventProfiler::enabled)` checks at the dispatch sites.
+ * Handler times are inclusive, a handler that triggers another event also pays for that event's handlers.
+ */
+class EventProfiler {
+public:
+#ifdef UFO_PROFILE_EVENTS
+    static constexpr bool enabled = true;
+#else
+    static constexpr bool enabled = false;
+#endif
+
+    using clock_t = std::chrono::steady_clock;
+
+    struct Stats {
+        const char* name = "";
+        uint64_t dispatches = 0;
+        uint64_t handlers = 0;
+        double totalMs = 0;
+        double maxMs = 0;
+        uint64_t payloadBytes = 0;
+        size_t maxPayloadBytes = 0;
+    };
+
+    static void recordDispatch(EventId eventId, const json& eventData);
+    static void recordHandler(EventId eventId, clock_t::time_point start);
+
+    // Per frame xProcess::update calls made by ProcessManager, and the ones skipped because the process is dormant
+    static void recordFrameUpdates(size_t updateCalls, size_t dormantSkipped);
+    [[nodiscard]] static std::string frameUpdateSummary();
+
+    // Sorted by total handler time, highest first
+    [[nodiscard]] static std::vector<Stats> snapshot();
+    static void reset();
+    static bool dumpCsv(const std::string& path);
+};
+
+#endif //CSCI437_EVENTPROFILER_H
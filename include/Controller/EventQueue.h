@@ -0,0 +1,157 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Peter Greek
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * Proper permission is grated by the copyright holder.
+ *
+ * Credit is attributed to the copyright holder in some form in the product.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+//
+// Created by xerxe on 10/18/2026.
+//
+
+#ifndef CSCI437_EVENTQUEUE_H
+#define CSCI437_EVENTQUEUE_H
+
+#include "Util.h"
+#include "MPSCQueue.h"
+#include <vector>
+#include <thread>
+
+/*
+ * Deferred event dispatch. QueueEvent appends to a ring buffer for one of the frame phases and the event is
+ * delivered in order when that phase is flushed:
+ *   INPUT    - view::update, right after the SDL poll loop
+ *   SIMULATE - main loop, after updateProcessList
+ *   RENDER   - view::update, before SDL::OnUpdate
+ *   LATE     - main loop, after the frame is presented
+ * Events queued while their own phase is flushing wait for the next frame, so a flush always ends.
+ * TriggerEvent is still immediate, render calls should keep using it. Main thread only.
+ *
+ * Other threads (timers, loaders, save writers) use post() instead, it goes through a lock-free MPSC queue and is
+ * drained by the main loop at the start of each frame. main's passFunc reroutes a TriggerEvent made off the main
+ * thread through post(), so handlers always run on the main thread.
+ */
+class EventQueue {
+public:
+    enum Phase {
+        INPUT,
+        SIMULATE,
+        RENDER,
+        LATE,
+        PHASE_COUNT
+    };
+
+    static void push(Phase phase, EventId eventId, json eventData) {
+        rings[phase].push({eventId, std::move(eventData)});
+    }
+
+    static void flush(Phase phase, const passFunc_t& dispatch) {
+        Ring& ring = rings[phase];
+        size_t count = ring.size();
+        for (size_t i = 0; i < count; i++) {
+            Entry entry = ring.pop();
+            dispatch(entry.eventId, entry.eventData);
+        }
+    }
+
+    [[nodiscard]] static size_t pending(Phase phase) { return rings[phase].size(); }
+
+    // Drop a phase without delivering it, headless mode does this to RENDER
+    static void discard(Phase phase) { rings[phase].clear(); }
+
+    // Any thread
+    static void post(EventId eventId, json eventData) {
+        posted.push({eventId, std::move(eventData)});
+    }
+
+    // Main thread, delivers everything posted so far
+    static void drainPosted(const passFunc_t& dispatch) {
+        Entry entry;
+        while (posted.pop(entry)) {
+            dispatch(entry.eventId, entry.eventData);
+        }
+    }
+
+    static void setMainThread() { mainThread = std::this_thread::get_id(); }
+    [[nodiscard]] static bool onMainThread() { return std::this_thread::get_id() == mainThread; }
+
+    static void clear() {
+        for (auto& ring : rings) ring.clear();
+        Entry entry;
+        while (posted.pop(entry)) {}
+    }
+
+private:
+    struct Entry {
+        EventId eventId;
+        json eventData;
+    };
+
+    // Power of two ring, doubles when full. Slots are reused frame to frame so steady state doesn't allocate.
+    class Ring {
+    public:
+        void push(Entry entry) {
+            if (count == slots.size()) grow();
+            slots[(head + count) & (slots.size() - 1)] = std::move(entry);
+            count++;
+        }
+
+        Entry pop() {
+            Entry entry = std::move(slots[head]);
+            head = (head + 1) & (slots.size() - 1);
+            count--;
+            return entry;
+        }
+
+        [[nodiscard]] size_t size() const { return count; }
+
+        void clear() {
+            while (count > 0) pop();
+            head = 0;
+        }
+
+    private:
+        std::vector<Entry> slots = std::vector<Entry>(64);
+        size_t head = 0;
+        size_t count = 0;
+
+        void grow() {
+            std::vector<Entry> bigger(slots.size() * 2);
+            for (size_t i = 0; i < count; i++) {
+                bigger[i] = std::move(slots[(head + i) & (slots.size() - 1)]);
+            }
+            slots = std::move(bigger);
+            head = 0;
+        }
+    };
+
+    static Ring rings[PHASE_COUNT];
+    static inline MPSCQueue<Entry> posted;
+    static inline std::thread::id mainThread = std::this_thread::get_id();
+};
+
+inline EventQueue::Ring EventQueue::rings[EventQueue::PHASE_COUNT];
+
+#endif //CSCI437_EVENTQUEUE_H
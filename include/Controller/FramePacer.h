@@ -0,0 +1,93 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Peter Greek
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * Proper permission is grated by the copyright holder.
+ *
+ * Credit is attributed to the copyright holder in some form in the product.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+//
+// Created by xerxe on 10/18/2026.
+//
+
+#ifndef CSCI437_FRAMEPACER_H
+#define CSCI437_FRAMEPACER_H
+
+#include <SDL.h>
+#include <string>
+
+/*
+ * Sleeps the main thread until a frame deadline without burning a core. The old wait() slept (remaining - 1 ms)
+ * and spun the rest, which is a full core at 90 FPS. Here the OS sleep is asked for everything except a margin,
+ * the margin tracks how late the OS actually wakes us (running mean + 2 deviations), and only that margin is spun.
+ * With a high resolution timer the margin settles at a few hundred microseconds.
+ *
+ * SPIN keeps the old behaviour around for comparison.
+ */
+class FramePacer {
+public:
+    enum Mode { SPIN, ADAPTIVE };
+
+    FramePacer();
+    ~FramePacer();
+    FramePacer(const FramePacer&) = delete;
+    FramePacer& operator=(const FramePacer&) = delete;
+
+    // Block until the performance counter reaches deadline
+    void waitUntil(Uint64 deadline);
+
+    // Called once per frame with the measured frame interval, samples CPU time of the calling thread
+    void recordFrame(double intervalMs);
+
+    void setMode(Mode m) { mode = m; resetStats(); }
+    [[nodiscard]] Mode getMode() const { return mode; }
+    [[nodiscard]] double getSleepMarginMs() const { return sleepMarginMs; }
+
+    // Frames, average frame time, jitter (standard deviation and max), CPU ms per frame and share of the frame
+    [[nodiscard]] std::string report() const;
+    void resetStats();
+
+private:
+    Mode mode = ADAPTIVE;
+    Uint64 clocksPerSecond = SDL_GetPerformanceFrequency();
+    void* highResTimer = nullptr; // Windows waitable timer, null elsewhere
+
+    // Oversleep estimate, exponentially weighted so it follows changes in system load
+    double overshootMean = 1.0;
+    double overshootVar = 0.0;
+    double sleepMarginMs = 1.0;
+
+    // Stats since the last reset
+    long long frames = 0;
+    double intervalSum = 0;
+    double intervalSumSq = 0;
+    double intervalMax = 0;
+    double cpuSum = 0;
+    double lastCpuMs = -1;
+
+    void sleepFor(double ms);
+    static double threadCpuMs();
+};
+
+#endif //CSCI437_FRAMEPACER_H
@@ -0,0 +1,72 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Peter Greek
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * Proper permission is grated by the copyright holder.
+ *
+ * Credit is attributed to the copyright holder in some form in the product.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+//
+// Created by xerxe on 10/18/2026.
+//
+
+#ifndef CSCI437_FRAMETIMER_H
+#define CSCI437_FRAMETIMER_H
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+/*
+ * Per phase timings of the main loop, kept for the last CAPACITY frames in a fixed ring buffer. mark(phase) charges
+ * the time since the previous mark to that phase, so the marks have to follow the loop order. Always on, a frame
+ * costs a handful of clock reads.
+ */
+class FrameTimer {
+public:
+    using clock_t = std::chrono::steady_clock;
+
+    // In the order they happen in main.cpp
+    enum Phase { UPDATE, POLL, RENDER, PRESENT, LATE, WAIT, PHASE_COUNT };
+    static constexpr size_t CAPACITY = 2048;
+
+    struct PhaseStats {
+        const char* name;
+        float p50, p95, p99, max;
+    };
+
+    static void beginFrame();
+    static void mark(Phase phase);
+    static void endFrame();
+
+    [[nodiscard]] static size_t frameCount();
+    // One entry per phase plus a "frame" entry for the whole frame
+    [[nodiscard]] static std::vector<PhaseStats> percentiles();
+    static void reset();
+    static bool dumpCsv(const std::string& path);
+
+    static const char* phaseName(Phase phase);
+};
+
+#endif //CSCI437_FRAMETIMER_H
@@ -187,6 +187,7 @@ public:
 
     void Init();
     void Start();
+    void StartHeadless();
     void End(GAME_RESULT result);
     void Debug();
 
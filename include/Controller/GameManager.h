@@ -52,6 +52,9 @@
 #include "AudioLoader.h"
 #include "Boss.h"
 #include "Scheduler.h"
+#include "RenderEvents.h"
+#include "SpatialHash.h"
+#include <array>
 
 using sh_ptr_e = sh_ptr<entity>;
 using sh_ptr_at = sh_ptr<AT>;
@@ -68,7 +71,22 @@ private:
 
     bool gameRunning = false;
     std::list<sh_ptr<entity>> entityList;
+    SpatialHash<sh_ptr_e> entityGrid{64.0f}; // every entity in entityList, moved after EntityStore::integrate
+    std::vector<uint32_t> nearby; // query results, reused between handlers
+    std::vector<vector2> beamStart, beamEnd; // firing lasers, clipped at walls in one batch each step
+    std::vector<float> beamClip;
+    std::vector<Heading> beamHeadings;
+
+    // Typed views of entityList, filled by attachEntity and emptied by detachEntity. An entity's type tag always
+    // matches its class here (attachEntity refuses one that doesn't), so lookups never need a dynamic cast
+    sh_ptr_ply player;
+    std::vector<sh_ptr<Boss>> bosses;
+    std::vector<sh_ptr_e> enemies;
+    std::vector<sh_ptr_laser> lasers;
+    std::vector<sh_ptr_pew> projectiles;
+    std::array<std::vector<sh_ptr_e>, entity::ESCAPE_POD + 1> pickups; // by pType
     std::map<std::string, sh_ptr<text>> textMap;
+    std::unordered_map<ProcessId_t, sh_ptr<text>> pickupTextMap; // [E] prompts, keyed on the pickup's process id
     std::map<std::string, sh_ptr<AsepriteLoader>> asepriteMap;
     std::map<std::string, sh_ptr<Animation>> animMap;
     std::map<std::string, sh_ptr<TxdLoader>> txdMap;
@@ -84,7 +102,8 @@ private:
     int db_wall_index = -1;
     bool inShiftFind = false;
     vector2 shiftFindStart;
-    int gameOverTimeStamp = 0;
+    TaskHandle gameOverTask;
+    Task gameOverSequence();
 
     SDL_Rect srcRect = {1, 1, 1024, 1024}; // load the entire texture, 1 pixel in since there is white line
     SDL_Rect destRect = {
@@ -122,9 +141,9 @@ public:
     void playerTakeHit(const sh_ptr_ply& p, int damage);
 
     void handleEnemyUpdate(const sh_ptr_e& e, float deltaMs);
-    void handlePlayerUpdate(const sh_ptr_e& e, float deltaMs);
+    void handlePlayerUpdate(const sh_ptr_ply& p, float deltaMs);
 
-    void updatePlayerView(bool isVisible, const sh_ptr_e& e, float deltaMs);
+    void updatePlayerView(bool isVisible, const sh_ptr_ply& p, float deltaMs, vector2 renderCoords);
     void renderLaser(vector2 screenCoords, vector2 dim, const sh_ptr_laser& l);
     void renderEnemy(vector2 screenCoords, vector2 dim, const sh_ptr_e& e);
     void renderWorld(float deltaMs);
@@ -135,10 +154,36 @@ public:
     void renderHeart(vector2 screenCoords, vector2 dim, const sh_ptr_e& e);
     void renderHeart(vector2 screenCoords, vector2 dim, bool isBlue = false);
 
-    void handleBossUpdate(const sh_ptr_e& e, float deltaMs);
+    void handleBossUpdate(const sh_ptr<Boss>& b, float deltaMs);
+    void sweepProjectile(const sh_ptr_e& e);
+    void clipLasers();
 
     void terminateGame();
 
+    static void entityBounds(const sh_ptr_e& e, vector2& min, vector2& max);
+    void gridUpdate(const sh_ptr_e& e);
+    void gridRemove(const sh_ptr_e& e);
+    bool indexEntity(const sh_ptr_e& e);
+    void detachEntity(const sh_ptr_e& e);
+
+    template <typename T>
+    static void bucketAdd(std::vector<sh_ptr<T>>& bucket, sh_ptr<T> e) {
+        e->setIndexSlot(static_cast<uint32_t>(bucket.size()));
+        bucket.push_back(std::move(e));
+    }
+
+    template <typename T>
+    static void bucketRemove(std::vector<sh_ptr<T>>& bucket, const sh_ptr_e& e) {
+        uint32_t slot = e->getIndexSlot();
+        if (slot >= bucket.size() || bucket[slot] != e) return;
+        if (slot != bucket.size() - 1) {
+            bucket[slot] = std::move(bucket.back());
+            bucket[slot]->setIndexSlot(slot);
+        }
+        bucket.pop_back();
+        e->setIndexSlot(UINT32_MAX);
+    }
+
     void renderTextOnEntity(const sh_ptr_e &e, const std::string &textMapName, const std::string &textDefault);
 
     void renderPickupInteraction(const sh_ptr_ply &ply, const sh_ptr_e &e, vector2 &currentCoords);
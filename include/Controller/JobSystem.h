@@ -0,0 +1,99 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Peter Greek
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * Proper permission is grated by the copyright holder.
+ *
+ * Credit is attributed to the copyright holder in some form in the product.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+//
+// Created by xerxe on 10/18/2026.
+//
+
+#ifndef CSCI437_JOBSYSTEM_H
+#define CSCI437_JOBSYSTEM_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/*
+ * Small work-stealing pool for data parallel loops. parallelFor splits [0, count) into chunks, deals them out to
+ * one deque per thread (the calling thread gets one too) and blocks until every chunk has run. A thread works
+ * from the back of its own deque and steals from the front of the others once it runs dry.
+ * One parallelFor at a time, called from the main thread.
+ */
+class JobSystem {
+public:
+    using body_t = std::function<void(size_t begin, size_t end)>;
+
+    explicit JobSystem(unsigned workerCount = defaultWorkerCount());
+    ~JobSystem();
+
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    void parallelFor(size_t count, size_t grain, const body_t& body);
+
+    [[nodiscard]] unsigned threadCount() const { return static_cast<unsigned>(queues.size()); }
+
+    static unsigned defaultWorkerCount() {
+        unsigned hw = std::thread::hardware_concurrency();
+        return hw > 1 ? hw - 1 : 0;
+    }
+
+private:
+    struct Range {
+        size_t begin;
+        size_t end;
+    };
+
+    struct WorkQueue {
+        std::mutex m;
+        std::deque<Range> ranges;
+    };
+
+    std::vector<std::unique_ptr<WorkQueue>> queues; // [0] is the calling thread
+    std::vector<std::thread> workers;
+
+    std::mutex wakeMutex;
+    std::condition_variable wake;
+    uint64_t batch = 0; // bumped for every parallelFor, workers sleep until it changes
+    bool stopping = false;
+
+    const body_t* body = nullptr;
+    std::atomic<size_t> remaining{0};
+
+    void workerLoop(unsigned self);
+    bool runOne(unsigned self);
+    bool popOwn(unsigned self, Range& out);
+    bool steal(unsigned self, Range& out);
+};
+
+#endif //CSCI437_JOBSYSTEM_H
@@ -6,16 +6,46 @@
 #define CSCI437_PROCESSMANAGER_H
 #include <list>
 #include <memory>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
 #include "xProcess.h"
+#include "SlotMap.h"
+#include "JobSystem.h"
 #include <nlohmann/json.hpp>
 
 using json = nlohmann::json;
 
 class ProcessManager {
 private:
-    std::list<std::shared_ptr<xProcess>> processList;
-    std::list<UUID_t> uuidList;
+    SlotMap<std::shared_ptr<xProcess>> processList;
     passFunc_t passFunc;
+    bool updating = false;
+    std::vector<SlotHandle> pendingRemovals; // removeProcess calls made from inside updateProcessList
+
+    // Thread-safe updates are fanned out once there are enough of them to be worth waking the workers
+    static constexpr size_t PARALLEL_UPDATE_MIN = 64;
+    static constexpr size_t PARALLEL_UPDATE_GRAIN = 32;
+    bool parallelUpdates = true;
+    std::unique_ptr<JobSystem> jobs; // created on first use
+    std::vector<xProcess*> parallelBatch;
+
+    // event -> processes listening to it, kept in attach order so dispatch order matches the process list
+    struct Subscriber {
+        xProcess* process;
+        uint64_t order;
+        const EventManager::handlerList_t* handlers;
+    };
+    std::unordered_map<EventId, std::vector<Subscriber>, EventIdHash> subscriberIndex;
+    std::vector<std::pair<EventId, Subscriber>> pendingSubscribers; // added while an event was dispatching
+    uint64_t nextAttachOrder = 0;
+    int dispatchDepth = 0;
+    bool indexHasHoles = false;
+
+    void subscribe(EventId eventId, const Subscriber& subscriber);
+    void unsubscribeAll(xProcess* p);
+    void eraseAt(size_t index);
+    void flushSubscriberIndex();
 
 public:
     ProcessManager() = default;
@@ -25,13 +55,18 @@ public:
     void attachProcess(std::shared_ptr<xProcess> p);
     void abortAllProcess();
     int removeProcess(const std::shared_ptr<xProcess>& p);
-    void triggerEventInAll(const std::string& eventName, const json& eventData);
-    UUID_t generateUUID();
-    bool containsUUID(UUID_t uuid);
+    void triggerEventInAll(EventId eventId, const json& eventData);
+    [[nodiscard]] size_t subscriberCount(EventId eventId) const;
+    [[nodiscard]] size_t processCount() const { return processList.size(); }
+    void setParallelUpdates(bool enabled) { parallelUpdates = enabled; }
+    [[nodiscard]] bool getParallelUpdates() const { return parallelUpdates; }
+    bool containsId(ProcessId_t id) const;
 
     void attachProcess(xProcess *p);
 
     int removeProcess(xProcess *p);
+    int removeProcess(SlotHandle handle);
+    std::shared_ptr<xProcess> getProcess(SlotHandle handle);
 };
 
 
@@ -35,11 +35,14 @@
 #define CSCI437_SCHEDULER_H
 
 #include "Util.h"
+#include "TimerWheel.h"
+#include "FramePacer.h"
+#include "Task.h"
 #include <SDL.h>
 #include <chrono>
 #include <thread>
-#include <mutex>
 #include <cmath>
+#include <unordered_map>
 
 
 /*
@@ -56,22 +59,35 @@
 
 using high_res_time_point_t = std::chrono::time_point<std::chrono::high_resolution_clock>;
 
+// WALL timers count real time, GAME timers count simulated time: advanceGameStep() adds getFixedDeltaMs() for every
+// step the main loop runs, the same delta the processes get (timeFactor changes how many steps run)
+enum class TimerClock { WALL, GAME };
+
+struct TimerHandle {
+    SlotHandle handle;
+    TimerClock clock = TimerClock::WALL;
+};
+
 class Scheduler {
 private:
     bool running = true;
     float timeFactor = 1.0f;
     float gameTime = 0;
     high_res_time_point_t startTime = std::chrono::high_resolution_clock::now();
-    std::mutex m;
+    // Timers are ticked from run(), so callbacks fire on the main thread at the start of a frame
+    TimerWheel wallTimers;
+    TimerWheel gameTimers;
 
     // Timing config
     double updateRate = static_cast<double>(targetFPS);
-    double fixedDelta = 1.0 / updateRate;
+    double fixedDelta = 1.0 / simulationRate; // simulation step in seconds, independent of the render rate
     bool unlockFramerate = false;
+    bool headless = false; // one fixed step per run(), no waiting
 
     // SDL timing
     Uint64 clocksPerSecond = SDL_GetPerformanceFrequency();
     Uint64 desiredFrameTime = clocksPerSecond / updateRate;
+    Uint64 simulationStepTime = clocksPerSecond / simulationRate;
     Uint64 vsyncMaxError = clocksPerSecond * 0.0002;
     Uint64 snapFrequencies[8] = {};
 
@@ -82,9 +98,71 @@ private:
 
     // Frame timing
     Uint64 prevFrameTime = SDL_GetPerformanceCounter();
-    Uint64 frameAccumulator = 0;
+    Uint64 frameAccumulator = 0; // game time not yet simulated, in clocks
     bool resync = true;
     Uint64 frameStartTime = 0;
+    int simulationSteps = 0; // fixed steps due this frame
+    float interpolationAlpha = 1.0f; // how far the render sits between the last two simulation steps
+    float simulatedMs = 0; // game time stepped since the last nextFrame() resume
+    double gameClockMs = 0; // game time stepped since start, what GAME timers count
+
+    FramePacer pacer;
+
+    // Coroutine tasks, see Task.h. Waiters hold task handles, a cancelled task's entries are skipped when reached.
+    struct TaskEntry {
+        Task::handle_t coroutine;
+        SlotHandle timer; // pending seconds() wait on gameTimers
+        bool running = false;
+        bool cancelled = false;
+    };
+    struct FrameWaiter {
+        SlotHandle task;
+        float* delta;
+    };
+    struct EventWaiter {
+        SlotHandle task;
+        json* data;
+    };
+    SlotMap<TaskEntry> tasks;
+    std::vector<FrameWaiter> frameWaiters;
+    std::vector<FrameWaiter> frameResuming;
+    std::unordered_map<EventId, std::vector<EventWaiter>, EventIdHash> eventWaiters;
+    std::vector<SlotHandle> eventReady; // woken by notifyEvent, resumed at the start of the next frame
+    std::vector<SlotHandle> eventResuming;
+
+    void resumeTask(SlotHandle id) {
+        TaskEntry* entry = tasks.get(id);
+        if (!entry || entry->running) return;
+        Task::handle_t coroutine = entry->coroutine;
+        entry->running = true;
+        coroutine.resume(); // may start other tasks and move the SlotMap storage
+        entry = tasks.get(id);
+        entry->running = false;
+        if (coroutine.done() || entry->cancelled) {
+            gameTimers.cancel(entry->timer);
+            coroutine.destroy();
+            tasks.remove(id);
+        }
+    }
+
+    // Wall timers first, then event wake ups, then nextFrame(). Game timers advance from advanceGameStep()
+    void advanceTimersAndTasks(float wallMs) {
+        wallTimers.advance(wallMs);
+        float gameMs = simulatedMs;
+        simulatedMs = 0;
+
+        eventResuming.swap(eventReady);
+        for (SlotHandle id : eventResuming) resumeTask(id);
+        eventResuming.clear();
+
+        frameResuming.swap(frameWaiters);
+        for (FrameWaiter& waiter : frameResuming) {
+            if (!tasks.contains(waiter.task)) continue;
+            *waiter.delta = gameMs;
+            resumeTask(waiter.task);
+        }
+        frameResuming.clear();
+    }
 
 public:
     Scheduler() {
@@ -118,14 +196,23 @@ public:
 
     float run() {
         updateRate = static_cast<double>(targetFPS);
-        fixedDelta = 1.0 / updateRate;
         desiredFrameTime = clocksPerSecond / updateRate;
 
         unlockFramerate = unlimitedFrames;
-        elapsedTime();
+        float wallMs = elapsedTime();
+
+        if (headless) {
+            float stepMs = getFixedDeltaMs() * timeFactor;
+            simulationSteps = 1;
+            interpolationAlpha = 1.0f;
+            advanceTimersAndTasks(wallMs);
+            return stepMs;
+        }
+
         frameStartTime = SDL_GetPerformanceCounter();
         Uint64 deltaClocks = frameStartTime - prevFrameTime;
         prevFrameTime = frameStartTime;
+        pacer.recordFrame(static_cast<double>(deltaClocks) * 1000.0 / clocksPerSecond);
 
         if (deltaClocks > desiredFrameTime * 8) deltaClocks = desiredFrameTime;
         if (deltaClocks < 0) deltaClocks = 0;
@@ -149,35 +236,34 @@ public:
         deltaClocks += averagerResidual / timeHistoryCount;
         averagerResidual %= timeHistoryCount;
 
-        frameAccumulator += deltaClocks;
-        if (frameAccumulator > desiredFrameTime * 8) resync = true;
+        frameAccumulator += static_cast<Uint64>(static_cast<double>(deltaClocks) * timeFactor);
+        if (frameAccumulator > simulationStepTime * 8) resync = true; // spiral of death, drop the backlog
 
         if (resync) {
-            frameAccumulator = 0;
+            frameAccumulator = simulationStepTime;
             deltaClocks = desiredFrameTime;
             resync = false;
         }
 
+        simulationSteps = static_cast<int>(frameAccumulator / simulationStepTime);
+        frameAccumulator -= simulationSteps * simulationStepTime;
+        interpolationAlpha = static_cast<float>(frameAccumulator) / static_cast<float>(simulationStepTime);
+
         float deltaMs = static_cast<float>(deltaClocks) * 1000.0f / clocksPerSecond;
         deltaMs *= timeFactor;
-        return std::max(0.001f, deltaMs);
-    }
-
-    void wait() const {
-        if (unlockFramerate) return;
+        deltaMs = std::max(0.001f, deltaMs);
 
-        Uint64 frameEndTime = SDL_GetPerformanceCounter();
-        Uint64 elapsed = frameEndTime - frameStartTime;
-        float frameMs = static_cast<float>(elapsed) * 1000.0f / clocksPerSecond;
-
-        float waitTime = (1000.0f / updateRate) - frameMs;
-        if (waitTime > 1.0f) {
-            std::this_thread::sleep_for(std::chrono::milliseconds(static_cast<int>(waitTime - 1.0f)));
-        }
+        advanceTimersAndTasks(wallMs);
+        return deltaMs;
+    }
 
-        while (SDL_GetPerformanceCounter() - frameStartTime < desiredFrameTime) {}
+    void wait() {
+        if (unlockFramerate || headless) return;
+        pacer.waitUntil(frameStartTime + desiredFrameTime);
     }
 
+    FramePacer& getPacer() { return pacer; }
+
     void shutdown() { running = false; }
     bool isRunning() const { return running; }
 
@@ -185,22 +271,142 @@ public:
     float getTimeFactor() const { return timeFactor; }
 
     void setUnlockFramerate(bool v) { unlockFramerate = v; }
+    void setHeadless(bool v) { headless = v; }
+    [[nodiscard]] bool isHeadless() const { return headless; }
     void setTargetFPS(int fps) {
         updateRate = static_cast<double>(fps);
-        fixedDelta = 1.0 / updateRate;
         desiredFrameTime = clocksPerSecond / updateRate;
     }
 
-    void setTimeout(int delay, std::function<void()> function) {
-        std::thread t([delay, function, this]() {
-            // mutex to lock the thread
-            std::lock_guard<std::mutex> lock(m);
-            std::this_thread::sleep_for(std::chrono::milliseconds(delay));
-            function();
+    // Fixed simulation steps owed this frame. The main loop runs updateProcessList once per step with
+    // getFixedDeltaMs(), so simulation cost and behaviour do not depend on targetFPS.
+    [[nodiscard]] int getSimulationSteps() const { return simulationSteps; }
+    [[nodiscard]] float getFixedDeltaMs() const { return static_cast<float>(fixedDelta * 1000.0); }
+    // Once per simulation step the main loop actually runs. Game timers and seconds() waits resume from in here,
+    // so they stop with the simulation (minimised window) instead of expiring on the frame clock
+    void advanceGameStep() {
+        float ms = getFixedDeltaMs();
+        simulatedMs += ms;
+        gameClockMs += ms;
+        gameTimers.advance(ms);
+    }
+    [[nodiscard]] double getGameClockMs() const { return gameClockMs; }
+    // 0 = draw at the previous step's positions, 1 = draw at the latest step's positions
+    [[nodiscard]] float getInterpolationAlpha() const { return interpolationAlpha; }
+
+    // Run function once after delay ms. Main thread only, other threads should EventQueue::post instead.
+    TimerHandle setTimeout(int delay, std::function<void()> function, TimerClock clock = TimerClock::WALL) {
+        return {timers(clock).add(std::max(delay, 0), std::move(function)), clock};
+    }
+
+    // Run function every interval ms until the handle is cleared
+    TimerHandle setInterval(int interval, std::function<void()> function, TimerClock clock = TimerClock::WALL) {
+        uint64_t every = std::max(interval, 1);
+        return {timers(clock).add(every, std::move(function), every), clock};
+    }
+
+    bool clearTimer(TimerHandle timer) { return timers(timer.clock).cancel(timer.handle); }
+    [[nodiscard]] bool isTimerPending(TimerHandle timer) { return timers(timer.clock).pending(timer.handle); }
+
+    void clearAllTimers() {
+        wallTimers.clear();
+        gameTimers.clear();
+    }
+
+    TimerWheel& timers(TimerClock clock) { return clock == TimerClock::GAME ? gameTimers : wallTimers; }
+
+    // Take ownership of a task and run it up to its first co_await
+    TaskHandle startTask(Task task) {
+        Task::handle_t coroutine = task.release();
+        SlotHandle id = tasks.insert({coroutine});
+        coroutine.promise().scheduler = this;
+        coroutine.promise().self = id;
+        resumeTask(id);
+        return {id};
+    }
+
+    // Destroys the task's frame. A task cancelling itself (or being cancelled by something it called) stops at
+    // its next co_await instead.
+    bool cancelTask(TaskHandle task) {
+        TaskEntry* entry = tasks.get(task.handle);
+        if (!entry) return false;
+        if (entry->running) {
+            entry->cancelled = true;
+            return true;
+        }
+        gameTimers.cancel(entry->timer);
+        entry->coroutine.destroy();
+        tasks.remove(task.handle);
+        return true;
+    }
+
+    [[nodiscard]] bool isTaskRunning(TaskHandle task) const { return tasks.contains(task.handle); }
+    [[nodiscard]] size_t taskCount() const { return tasks.size(); }
+
+    // Called by main's passFunc for every event, wakes tasks waiting in co_await event(...)
+    void notifyEvent(EventId eventId, const json& eventData) {
+        if (eventWaiters.empty()) return;
+        auto it = eventWaiters.find(eventId);
+        if (it == eventWaiters.end()) return;
+        std::vector<EventWaiter> waiters = std::move(it->second);
+        eventWaiters.erase(it);
+        for (EventWaiter& waiter : waiters) {
+            if (!tasks.contains(waiter.task)) continue;
+            *waiter.data = eventData;
+            eventReady.push_back(waiter.task);
+        }
+    }
+
+    // Used by the awaiters below
+    void waitFrame(SlotHandle task, float* delta) { frameWaiters.push_back({task, delta}); }
+    void waitMs(SlotHandle task, uint64_t ms) {
+        TaskEntry* entry = tasks.get(task);
+        if (!entry) return;
+        entry->timer = gameTimers.add(ms, [this, task]() {
+            if (TaskEntry* waiting = tasks.get(task)) waiting->timer = {};
+            resumeTask(task);
         });
-        t.detach();
     }
+    void waitEvent(SlotHandle task, EventId eventId, json* data) { eventWaiters[eventId].push_back({task, data}); }
+
+    ~Scheduler() {
+        for (TaskEntry& entry : tasks) entry.coroutine.destroy();
+    }
+};
+
+// co_await nextFrame() resumes at the start of the next frame and gives back the game time simulated since it waited
+struct NextFrameAwaiter {
+    float delta = 0;
+    bool await_ready() const noexcept { return false; }
+    void await_suspend(Task::handle_t h) { h.promise().scheduler->waitFrame(h.promise().self, &delta); }
+    float await_resume() const noexcept { return delta; }
+};
+
+inline NextFrameAwaiter nextFrame() { return {}; }
+
+// co_await seconds(n) waits n seconds of game time, so timeFactor applies
+struct SecondsAwaiter {
+    float secs;
+    bool await_ready() const noexcept { return false; }
+    void await_suspend(Task::handle_t h) {
+        auto ms = static_cast<uint64_t>(std::max(0.0f, secs) * 1000.0f + 0.5f);
+        h.promise().scheduler->waitMs(h.promise().self, ms);
+    }
+    void await_resume() const noexcept {}
+};
+
+inline SecondsAwaiter seconds(float secs) { return {secs}; }
+
+// json data = co_await event("UFO::Something") resumes on the frame after the event fires, with its payload
+struct EventAwaiter {
+    EventId eventId;
+    json data;
+    bool await_ready() const noexcept { return false; }
+    void await_suspend(Task::handle_t h) { h.promise().scheduler->waitEvent(h.promise().self, eventId, &data); }
+    json await_resume() { return std::move(data); }
 };
 
+inline EventAwaiter event(EventId eventId) { return {eventId, json()}; }
+
 
 #endif //CSCI437_SCHEDULER_H
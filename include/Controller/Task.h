@@ -0,0 +1,101 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Peter Greek
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * Proper permission is grated by the copyright holder.
+ *
+ * Credit is attributed to the copyright holder in some form in the product.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+//
+// Created by xerxe on 10/18/2026.
+//
+
+#ifndef CSCI437_TASK_H
+#define CSCI437_TASK_H
+
+#include "SlotMap.h"
+#include "Util.h"
+#include <coroutine>
+#include <exception>
+#include <utility>
+
+class Scheduler;
+
+// Handle to a task started with Scheduler::startTask, stays safe to cancel after the task has finished
+struct TaskHandle {
+    SlotHandle handle;
+};
+
+/*
+ * Coroutine run by the Scheduler. A function returning Task can co_await nextFrame(), seconds(n) and event("...")
+ * (see Scheduler.h); while suspended it costs nothing per frame. Tasks start suspended and only run once handed to
+ * Scheduler::startTask, which owns the frame from then on. Every resume happens on the main thread from
+ * Scheduler::run(), so task bodies can touch processes and trigger events like any handler.
+ *
+ * A task that captures `this` must be cancelled by its owner's destructor (or earlier), the scheduler can't know
+ * when the object it points at goes away.
+ */
+class Task {
+public:
+    struct promise_type {
+        Scheduler* scheduler = nullptr;
+        SlotHandle self;
+
+        Task get_return_object() { return Task(std::coroutine_handle<promise_type>::from_promise(*this)); }
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        std::suspend_always final_suspend() noexcept { return {}; }
+        void return_void() {}
+        void unhandled_exception() {
+            try {
+                std::rethrow_exception(std::current_exception());
+            } catch (const std::exception& e) {
+                error("Task failed: ", e.what());
+            } catch (...) {
+                error("Task failed");
+            }
+        }
+    };
+    using handle_t = std::coroutine_handle<promise_type>;
+
+    Task(Task&& other) noexcept : coroutine(std::exchange(other.coroutine, {})) {}
+    Task& operator=(Task&& other) noexcept {
+        if (this != &other) {
+            if (coroutine) coroutine.destroy();
+            coroutine = std::exchange(other.coroutine, {});
+        }
+        return *this;
+    }
+    Task(const Task&) = delete;
+    Task& operator=(const Task&) = delete;
+    ~Task() { if (coroutine) coroutine.destroy(); }
+
+    // Hand the frame over, used by Scheduler::startTask
+    handle_t release() { return std::exchange(coroutine, {}); }
+
+private:
+    explicit Task(handle_t h) : coroutine(h) {}
+    handle_t coroutine;
+};
+
+#endif //CSCI437_TASK_H
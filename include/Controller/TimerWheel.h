@@ -0,0 +1,158 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Peter Greek
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * Proper permission is grated by the copyright holder.
+ *
+ * Credit is attributed to the copyright holder in some form in the product.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+//
+// Created by xerxe on 10/18/2026.
+//
+
+#ifndef CSCI437_TIMERWHEEL_H
+#define CSCI437_TIMERWHEEL_H
+
+#include "SlotMap.h"
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+/*
+ * Hierarchical timer wheel with 1 ms ticks. Four levels of 64 slots cover 2^24 ms (about 4.6 hours); anything
+ * further out waits in the last level and is placed again when its slot comes round. Timers live in a SlotMap so
+ * insert and cancel are O(1) no matter how many are pending: slots only hold handles, and a cancelled timer is
+ * skipped when its slot is drained because its handle no longer resolves.
+ *
+ * Not thread safe. Callbacks run from advance() on whichever thread owns the wheel (the main loop for the
+ * Scheduler's wheels), so they can trigger events directly.
+ */
+class TimerWheel {
+public:
+    using callback_t = std::function<void()>;
+
+    SlotHandle add(uint64_t delayMs, callback_t callback, uint64_t intervalMs = 0) {
+        uint64_t deadline = now + (delayMs == 0 ? 1 : delayMs);
+        SlotHandle handle = timers.insert({deadline, intervalMs, std::move(callback)});
+        place(handle, deadline);
+        return handle;
+    }
+
+    bool cancel(SlotHandle handle) { return timers.remove(handle); }
+    [[nodiscard]] bool pending(SlotHandle handle) const { return timers.contains(handle); }
+    [[nodiscard]] size_t size() const { return timers.size(); }
+    [[nodiscard]] uint64_t time() const { return now; }
+
+    // Move the wheel forward, firing every timer whose deadline is crossed. Fractions of a tick carry over.
+    void advance(double elapsedMs) {
+        carry += elapsedMs;
+        auto ticks = static_cast<uint64_t>(carry);
+        carry -= static_cast<double>(ticks);
+
+        while (ticks-- > 0) {
+            if (timers.empty()) { // nothing to fire, skip the rest of the walk
+                now += ticks + 1;
+                return;
+            }
+            tick();
+        }
+    }
+
+    void clear() {
+        timers.clear();
+        for (auto& level : wheel) {
+            for (auto& slot : level) slot.clear();
+        }
+    }
+
+private:
+    static constexpr int LEVELS = 4;
+    static constexpr int SLOT_BITS = 6;
+    static constexpr uint64_t SLOTS = 1u << SLOT_BITS;
+    static constexpr uint64_t SLOT_MASK = SLOTS - 1;
+
+    struct Timer {
+        uint64_t deadline;
+        uint64_t interval; // 0 for one-shot
+        callback_t callback;
+    };
+
+    SlotMap<Timer> timers;
+    std::vector<SlotHandle> wheel[LEVELS][SLOTS];
+    std::vector<SlotHandle> firing; // reused between ticks so draining a slot does not allocate
+    uint64_t now = 0;
+    double carry = 0;
+
+    // Level is picked from the highest bit where the deadline and the current time differ, so the slot is always
+    // ahead of the current one and a timer only cascades down once per level on its way to level 0. Deadlines past
+    // the wheel range land in the last level and get placed again when that slot cascades.
+    void place(SlotHandle handle, uint64_t deadline) {
+        uint64_t diff = deadline ^ now;
+        int level = 0;
+        while (level < LEVELS - 1 && (diff >> (SLOT_BITS * (level + 1))) != 0) level++;
+        wheel[level][(deadline >> (SLOT_BITS * level)) & SLOT_MASK].push_back(handle);
+    }
+
+    void cascade(int level) {
+        auto& slot = wheel[level][(now >> (SLOT_BITS * level)) & SLOT_MASK];
+        if (slot.empty()) return;
+        std::vector<SlotHandle> moving;
+        moving.swap(slot);
+        for (SlotHandle handle : moving) {
+            if (Timer* timer = timers.get(handle)) place(handle, timer->deadline);
+        }
+    }
+
+    void tick() {
+        now++;
+        for (int level = 1; level < LEVELS; level++) {
+            if ((now & ((1ull << (SLOT_BITS * level)) - 1)) != 0) break;
+            cascade(level);
+        }
+
+        auto& slot = wheel[0][now & SLOT_MASK];
+        if (slot.empty()) return;
+        firing.swap(slot);
+        for (SlotHandle handle : firing) {
+            Timer* timer = timers.get(handle);
+            if (!timer) continue; // cancelled
+
+            if (timer->interval == 0) {
+                callback_t callback = std::move(timer->callback);
+                timers.remove(handle);
+                callback();
+            } else {
+                timer->deadline = now + timer->interval;
+                place(handle, timer->deadline);
+                // the callback may add timers and move the SlotMap storage, so it runs from a local
+                callback_t callback = std::move(timer->callback);
+                callback();
+                if (Timer* stillPending = timers.get(handle)) stillPending->callback = std::move(callback);
+            }
+        }
+        firing.clear();
+    }
+};
+
+#endif //CSCI437_TIMERWHEEL_H
@@ -10,6 +10,7 @@
 #include "jsonLoader.h"
 #include "TxdLoader.h"
 #include "wall.h"
+#include "OBBGrid.h"
 #include "vector"
 #include <unordered_set>
 
@@ -60,6 +61,13 @@ private:
     std::unordered_set<std::string> usedRoomTypes;
     std::unordered_map<std::string, int> roomTypeCount;
     std::vector<std::string> requiredRoomTypes;
+
+    // Walls packed per grid cell, the wall tests run the batch kernels over the cells a query touches
+    OBBGrid wallGrid{128.0f};
+    std::unordered_map<wall*, uint32_t> wallSlots;
+    void rebuildWallGrid();
+    void gridAddWall(wall* w);
+    void gridRemoveWall(wall* w);
     json getRoomById(const json& templates, const std::string& id);
     void offsetRoom(json& room, const vector2& offset);
     void rotateRoom(json& room, float angle);
@@ -74,7 +82,8 @@ private:
     json* findUnusedDoor(json& room);
     json pickUsedSpecialRoom(const json& templates);
 public:
-    explicit world(const std::function<void(const std::string& eventName, const json& eventData)>& func) : xProcess(false, func) {
+    explicit world(const passFunc_t& func) : xProcess(false, func) {
+        setDormant(true);
         worldData = jsonLoader(worldPath);
     }
 
@@ -90,7 +99,15 @@ public:
     wallList_t getWallList();
     roomList_t getRoomList();
     bool isPointInWall(vector2 vector21);
-    bool isRectInWall(vectorList_t& rect);
+    bool isRectInWall(const AABB& box);
+    // box moving by delta, toi is the fraction of delta travelled before it touches a wall
+    bool sweepRectInWall(const AABB& box, vector2 delta, float& toi);
+    // Distance along dir (unit length) from origin to the first wall, maxDist when nothing is in the way. Walls the
+    // origin is inside of are ignored
+    float raycast(vector2 origin, vector2 dir, float maxDist);
+    bool hasLineOfSight(vector2 from, vector2 to);
+    // fraction[i] is how far along from[i] to to[i] the first wall is, 1 when clear
+    void segmentsToWalls(const std::vector<vector2>& from, const std::vector<vector2>& to, std::vector<float>& fraction);
     int addRoom();
     void updateWall(int roomId, int wallId, wall *w);
     int addWall(int roomId, wall *w);
@@ -36,6 +36,7 @@
 
 #include "config.h"
 #include "Util.h"
+#include "SlotMap.h"
 
 #include <SDL.h>
 #include <EventManager.h>
@@ -54,10 +55,12 @@ public:
         ABORT
     };
 private:
-    UUID_t id;
+    SlotHandle handle; // where the ProcessManager keeps this process, cleared on removal
+    ProcessId_t id = SlotHandle{}.pack(); // the handle it was attached with, still readable after removal
     State state_;
     xProcess* child_;
     bool isSDLProcess = false;
+    bool dormant = false;
 public:
     xProcess(bool isSDL, passFunc_t func) : EventManager(std::move(func)) {
         state_ = UNINITIALIZED;
@@ -66,8 +69,13 @@ public:
     }
     virtual ~xProcess() = default;
 
-    UUID_t getId() const { return id; }
-    void setId(UUID_t UID) { id = UID; }
+    [[nodiscard]] ProcessId_t getId() const { return id; }
+    [[nodiscard]] std::string getIdString() const { return formatProcessId(getId()); }
+    [[nodiscard]] SlotHandle getHandle() const { return handle; }
+    void setHandle(SlotHandle h) {
+        handle = h;
+        if (h.valid()) id = h.pack(); // generations make it unique, a removed process keeps its id
+    }
 
     bool isSDLSubProcess() const { return isSDLProcess; }
 
@@ -76,10 +84,19 @@ public:
     virtual int initialize_manual() { state_ = RUNNING_MANUAL; return 1;}
     virtual int initialize_SDL_process(SDL_Window* window) { state_ = RUNNING; return 1;}
     virtual void update(float deltaMs) = 0;
+    // Return true if update() only touches this process's own state (no SDL, no other processes, no events).
+    // ProcessManager then runs it on the job system alongside the other thread-safe updates.
+    [[nodiscard]] virtual bool threadSafeUpdate() const { return false; }
+
+    // Dormant processes have nothing to do per frame (loaders, camera, world). ProcessManager still initializes
+    // them and runs their post* callbacks, and they keep receiving events, but update() is not called.
+    void setDormant(bool d) { dormant = d; }
+    [[nodiscard]] bool isDormant() const { return dormant; }
     virtual bool isDone() = 0;
 
     State state() { return state_; }
     bool dead() const { return state_ == SUCCESS || state_ == FAIL || state_ == ABORT; }
+    [[nodiscard]] bool acceptsEvents() const override { return !dead(); }
 
     void succeed() { state_ = SUCCESS; }
     void fail() { state_ = FAIL; }
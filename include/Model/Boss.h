@@ -7,13 +7,12 @@
 
 #include "entity.h"
 #include "Projectile.h"
+#include "Scheduler.h"
 
 class Boss : public entity, public std::enable_shared_from_this<Boss> {
 private:
     int timeBetweenSpawnsMinion = 15000;
-    int lastMinionSpawnTime = 0;
-    int inRage = 0;
-    int rageTime = 0;
+    int timeBetweenSpawnsMinionRage = 10000;
     std::vector<sh_ptr_e> minions;
     std::vector<sh_ptr_e> projectiles;
     int minionCount = 0;
@@ -23,13 +22,33 @@ private:
     passFunc_t passFunc;
 
     int timeBetweenSpawnsProjectile = 5000;
-    int lastProjectileSpawnTime = 0;
+
+    // Spawn cooldowns run as scheduler tasks, restarted every time something is spawned. Entering rage shortens
+    // the running ones to the rage interval, counted from the same start
+    sh_ptr<Scheduler> sch;
+    bool rageStarted = false;
+    bool minionReady = false;
+    bool projectileReady = false;
+    double minionCooldownStart = 0; // Scheduler::getGameClockMs() when the cooldown began
+    double projectileCooldownStart = 0;
+    TaskHandle minionCooldown;
+    TaskHandle projectileCooldown;
+    Task cooldown(bool& ready, int ms);
+    void restartCooldown(TaskHandle& task, bool& ready, double& start, int ms);
+    void shortenCooldown(TaskHandle& task, bool& ready, double start, int ms);
+    [[nodiscard]] int minionInterval() const;
+    [[nodiscard]] int projectileInterval() const;
 public:
     explicit Boss(
             passFunc_t& func,
             vector2 position
     ) : entity(func, entity::ENEMY_BOSS, 15, position, 128, 128), passFunc(func) {};
+    ~Boss() override;
+    // Starts the spawn cooldowns, GameManager::attachEntity hands this over
+    void setScheduler(sh_ptr<Scheduler> scheduler);
     void update(float deltaMs) override;
+    // Can drop the last reference to a minion, and process destructors unhook events, so keep it on the main thread
+    [[nodiscard]] bool threadSafeUpdate() const override { return false; }
 
     [[nodiscard]] bool inRageMode() const;
     bool isMinion(const sh_ptr_e& e) const;
@@ -0,0 +1,126 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Peter Greek
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * Proper permission is grated by the copyright holder.
+ *
+ * Credit is attributed to the copyright holder in some form in the product.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+//
+// Created by xerxe on 10/18/2026.
+//
+
+
+#ifndef CSCI437_ENTITYSTORE_H
+#define CSCI437_ENTITYSTORE_H
+
+#include "vector2.h"
+#include <cstdint>
+#include <vector>
+
+/*
+ * Structure of arrays behind every entity. Position, velocity, size, hearts, type, flags and the two gameplay
+ * timers live in parallel dense arrays; an entity only keeps its id and reads through it. Removal swaps the last row
+ * into the hole, so the arrays never have gaps and the sweeps below walk them front to back.
+ *
+ * Ids are stable for the entity's lifetime and map to a row through one lookup. Rows are added and removed only on
+ * the main thread (entity construction and destruction); the parallel process update may read any row and write
+ * its own entity's row, never resize.
+ */
+class EntityStore {
+public:
+    static constexpr uint32_t INVALID = UINT32_MAX;
+
+    enum Flags : uint8_t {
+        SPAWNED = 1,
+        INVINCIBLE = 2,
+        KNOCKED_BACK = 4,
+        IN_VIEW = 8, // set by cull()
+    };
+
+    static uint32_t create(int type, vector2 position, int length, int width, int hearts);
+    static void destroy(uint32_t id);
+    [[nodiscard]] static size_t size() { return rows.position.size(); }
+
+    static vector2& position(uint32_t id) { return rows.position[row[id]]; }
+    static vector2& lastPosition(uint32_t id) { return rows.lastPosition[row[id]]; }
+    static vector2& velocity(uint32_t id) { return rows.velocity[row[id]]; }
+    static vector2& spawnPosition(uint32_t id) { return rows.spawnPosition[row[id]]; }
+    static int& length(uint32_t id) { return rows.length[row[id]]; }
+    static int& width(uint32_t id) { return rows.width[row[id]]; }
+    static int& hearts(uint32_t id) { return rows.hearts[row[id]]; }
+    static int& maxHearts(uint32_t id) { return rows.maxHearts[row[id]]; }
+    static uint8_t& type(uint32_t id) { return rows.type[row[id]]; }
+    static float& knockbackTime(uint32_t id) { return rows.knockbackTime[row[id]]; }
+    static float& invincibleTime(uint32_t id) { return rows.invincibleTime[row[id]]; }
+
+    [[nodiscard]] static bool hasFlag(uint32_t id, Flags flag) { return rows.flags[row[id]] & flag; }
+    static void setFlag(uint32_t id, Flags flag, bool on) {
+        uint8_t& f = rows.flags[row[id]];
+        f = on ? (f | flag) : (f & ~flag);
+    }
+
+    // Projectile table, only projectiles have a row here
+    static void addProjectile(uint32_t id, float range);
+    static float& projectileRange(uint32_t id) { return projectiles.range[projectileRow[id]]; }
+
+    // Moves every entity by its velocity and clamps it to the world's vertical bounds (was per entity
+    // updateCoordsFromVelocity)
+    static void integrate(float deltaMs);
+    // Sets IN_VIEW on every entity whose interpolated position is inside [min, max]
+    static void cull(vector2 min, vector2 max, float alpha);
+
+private:
+    struct Rows {
+        std::vector<vector2> position;
+        std::vector<vector2> lastPosition;
+        std::vector<vector2> velocity;
+        std::vector<vector2> spawnPosition;
+        std::vector<int> length;
+        std::vector<int> width;
+        std::vector<int> hearts;
+        std::vector<int> maxHearts;
+        std::vector<uint8_t> type;
+        std::vector<uint8_t> flags;
+        std::vector<float> knockbackTime;
+        std::vector<float> invincibleTime;
+        std::vector<uint32_t> id; // row -> id, to patch row[] when a row moves
+    };
+
+    struct ProjectileRows {
+        std::vector<float> range;
+        std::vector<uint32_t> id;
+    };
+
+    inline static Rows rows;
+    inline static std::vector<uint32_t> row; // id -> row, INVALID when the id is free
+    inline static std::vector<uint32_t> freeIds;
+
+    inline static ProjectileRows projectiles;
+    inline static std::vector<uint32_t> projectileRow; // id -> projectile row, INVALID when not a projectile
+
+    static void removeProjectile(uint32_t id);
+};
+
+#endif //CSCI437_ENTITYSTORE_H
@@ -45,6 +45,11 @@ private:
     bool spinning = false;
     bool clockWise = false;
 
+    // Heading and length of the beam as last clipped at walls. The heading is kept because the laser spins in its
+    // own update after the clip, drawing or hit testing the new heading with the old length would cross walls
+    Heading beamHeading;
+    float beamLength = -1; // -1 until the first clip
+
     // Time vars
     float lastFired = 0;
     float inFire = 0;
@@ -82,6 +87,9 @@ public:
     float getInterval() const;
     float getDuration() const;
     float timeLeft();
+    Heading getBeamHeading();
+    float getBeamLength();
+    void setBeam(Heading h, float l);
 };
 
 
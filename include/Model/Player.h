@@ -98,6 +98,7 @@ public:
 
     int localInit();
     void update(float deltaMs) override;
+    [[nodiscard]] bool threadSafeUpdate() const override { return false; } // reads SDL keyboard state
 
     // Upgrade functions
     void applyUpgrade(UPGRADES upgrade, int level);
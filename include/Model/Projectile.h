@@ -40,7 +40,8 @@
 class Projectile : public entity {
 private:
     std::weak_ptr<entity> owner;
-    float range = getScaledCoords(vector2(500, 500)).length();
+
+    void addRange() { EntityStore::addProjectile(getStoreId(), getScaledCoords(vector2(500, 500)).length()); }
 
     vector2 getProjectileDimensions(std::shared_ptr<entity> parent, int damage) {
         print("Parent: ", parent->getEntityType(), " Damage: ", damage);
@@ -56,7 +57,7 @@ private:
 
 public:
     explicit Projectile(passFunc_t& func, vector2 position)
-            : entity(func, entity::PROJECTILE, 1, position) {}
+            : entity(func, entity::PROJECTILE, 1, position) { addRange(); }
 
     Projectile(passFunc_t& func, vector2 position, std::shared_ptr<entity> parent)
         : entity(func,
@@ -64,10 +65,10 @@ public:
                  1,
                  position,
                  getProjectileDimensions(parent, 1)
-        ), owner(parent) {}
+        ), owner(parent) { addRange(); }
 
     Projectile(passFunc_t& func, vector2 position, int damage)
-            : entity(func, entity::PROJECTILE, damage, position) {}
+            : entity(func, entity::PROJECTILE, damage, position) { addRange(); }
 
     Projectile(passFunc_t& func, vector2 position, int damage, std::shared_ptr<entity> parent)
         : entity(func,
@@ -75,7 +76,7 @@ public:
                  damage,
                  position,
                  getProjectileDimensions(parent, damage)
-        ),owner(parent) {}
+        ),owner(parent) { addRange(); }
 
     // Owner Management
     void setOwner(const std::shared_ptr<entity>& newOwner) {owner = newOwner;}
@@ -85,9 +86,9 @@ public:
     [[nodiscard]] bool hasOwner() const {return !owner.expired();}
 
     // Range Check
-    void setRange(float r) { range = r; }
-    [[nodiscard]] float getRange() const { return range; }
-    bool isOutOfRange() {return (getPosition() - getSpawnCoords()).length() > range;}
+    void setRange(float r) { EntityStore::projectileRange(getStoreId()) = r; }
+    [[nodiscard]] float getRange() const { return EntityStore::projectileRange(getStoreId()); }
+    bool isOutOfRange() {return (getPosition() - getSpawnCoords()).length() > getRange();}
 
     int getDamage() const {return getHearts();} // get the damage of the projectile
 };
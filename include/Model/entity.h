@@ -35,6 +35,7 @@
 #define CSCI437_ENTITY_H
 
 #include "xProcess.h"
+#include "EntityStore.h"
 
 
 class entity : public xProcess {
@@ -57,41 +58,25 @@ public:
     };
 
 private:
-    vector2 spawnCoords;
+    uint32_t id; // row in EntityStore, everything the hot loops read lives there
     bool created = false;
-    bool spawned = false;
-    eType type;
-    int hearts;
-    int maxHearts;
-    vector2 coords;
-    vector2 lastCoords;
-    vector2 vel;
-
-    bool inKnockback = false;
-    float knockbackRemaining = 0;
-    bool isInvincible = false; // is the player invincible
-    float invincibleTime = 0; // time left of invincibility
-
-    int length = 10;
-    int width = 10;
 
     int appliedLength = 10; // length applied to the entity
     int appliedWidth = 10; // width applied to the entity
 
+    uint32_t spatialSlot = UINT32_MAX; // id in GameManager's entity grid, UINT32_MAX when not in it
+    uint32_t indexSlot = UINT32_MAX; // position in GameManager's typed bucket for this entity's type
+
     void setDefaultLengthWidth() {
         vector2 def = getDefLengthWidth();
-        length = def.x;
-        width = def.y;
+        EntityStore::length(id) = def.x;
+        EntityStore::width(id) = def.y;
     }
 public:
     explicit entity(
             passFunc_t& func,
             int eTypeIndex, int hearts, vector2 position
-    ) : xProcess(false, func),hearts(hearts), maxHearts(hearts) {
-        coords = position;
-        type = static_cast<eType>(eTypeIndex);
-        spawnCoords = {position.x, position.y};
-        lastCoords = {position.x, position.y};
+    ) : xProcess(false, func), id(EntityStore::create(eTypeIndex, position, 10, 10, hearts)) {
         setDefaultLengthWidth();
     }
 
@@ -99,13 +84,8 @@ public:
             passFunc_t& func,
             int eTypeIndex, int hearts, vector2 position,
             int length, int width
-    ) : xProcess(false, func), length(length), width(width), hearts(hearts), maxHearts(hearts) {
-        coords = position;
-        appliedLength = length;
-        appliedWidth = width;
-        type = static_cast<eType>(eTypeIndex);
-        spawnCoords = {position.x, position.y};
-        lastCoords = {position.x, position.y};
+    ) : xProcess(false, func), id(EntityStore::create(eTypeIndex, position, length, width, hearts)),
+        appliedLength(length), appliedWidth(width) {
         setDefaultLengthWidth();
     }
 
@@ -113,18 +93,18 @@ public:
             passFunc_t& func,
             int eTypeIndex, int hearts, vector2 position,
             vector2 dimensions
-    ) : xProcess(false, func), length(dimensions.x), width(dimensions.y), hearts(hearts), maxHearts(hearts){
-        coords = position;
-        appliedLength = length;
-        appliedWidth = width;
-        type = static_cast<eType>(eTypeIndex);
-        spawnCoords = {position.x, position.y};
-        lastCoords = {position.x, position.y};
+    ) : xProcess(false, func), id(EntityStore::create(eTypeIndex, position, dimensions.x, dimensions.y, hearts)),
+        appliedLength(dimensions.x), appliedWidth(dimensions.y) {
         setDefaultLengthWidth();
     }
 
+    entity(const entity&) = delete;
+    entity& operator=(const entity&) = delete;
+    ~entity() override { EntityStore::destroy(id); }
+
     int initialize() override;
     void update(float deltaMs) override;
+    [[nodiscard]] bool threadSafeUpdate() const override { return true; } // invincibility timer only, see Player
     bool isDone() override;
     void postSuccess() override { onTriggerEvent("ENTITY::SUCCEED", json {}); };
     void postFail() override { onTriggerEvent("ENTITY::FAILED", json {}); };
@@ -139,7 +119,7 @@ public:
     [[nodiscard]] vector2 getDimensions() const;
     vector2 getDefLengthWidth() {
         // this is staying in h file as its basically a config
-        switch (type) {
+        switch (getEntityType()) {
             case PLAYER:
                 return {getScaledPixelWidth(64.0f), getScaledPixelHeight(48.0f)};
             case ENEMY:
@@ -164,6 +144,7 @@ public:
         }
     }
 
+    [[nodiscard]] AABB getBounds() const; // hit box, centered on the position
     [[nodiscard]] bool isPointInEntity(vector2 point) const;
 
     bool isEntityAPlayer();
@@ -191,6 +172,8 @@ public:
     vector2 getPosition();
     void updateCoordsFromVelocity(float deltaMs);
     vector2 getLastCoords();
+    // Position between the last two simulation steps, for drawing. alpha comes from Scheduler::getInterpolationAlpha
+    [[nodiscard]] vector2 getRenderPosition(float alpha) const;
 
     void setVelocity(vector2 newVelocity);
     vector2 getVelocity();
@@ -207,6 +190,14 @@ public:
 
     [[nodiscard]] eType getEntityType() const;
 
+    [[nodiscard]] uint32_t getStoreId() const;
+    [[nodiscard]] bool isInView() const; // from the last EntityStore::cull
+
+    [[nodiscard]] uint32_t getSpatialSlot() const;
+    void setSpatialSlot(uint32_t slot);
+    [[nodiscard]] uint32_t getIndexSlot() const;
+    void setIndexSlot(uint32_t slot);
+
     [[nodiscard]] bool isEntityInEntity(const sh_ptr<entity>& other) const;
 };
 
@@ -42,40 +42,49 @@ public:
     int length;
     int width;
     Heading heading;
-    std::vector<vector2> corners;
+    OBB box;
+    Quad corners; // bottom-left, bottom-right, top-right, top-left
 
     wall(const vector2& pos, int len, int w, int h)
             : position(pos), length(len), width(w), heading(h) {
-        corners = getCorners();
+        updateShape();
     }
 
     wall(const vector2& pos, int len, int w, Heading h)
             : position(pos), length(len), width(w), heading(h) {
-        corners = getCorners();
+        updateShape();
     }
 
     wall(): heading(0), length(0), width(0) {
-        corners = getCorners();
+        updateShape();
     };
 
-    [[nodiscard]] std::vector<vector2> getCorners() const {
+    // Runs from position along heading for length, width / 2 either side of it
+    [[nodiscard]] OBB getBox() const {
         vector2 dir = angleToVector2(heading); // Convert angle to unit direction
-        vector2 perp(-dir.y, dir.x); // Perpendicular for width
+        return OBB::fromSegment(position, dir, static_cast<float>(length), static_cast<float>((width / 2) * 2));
+    }
 
-        vector2 p1 = position - (perp * (width / 2)); // Bottom-left
-        vector2 p2 = position + (perp * (width / 2)); // Bottom-right
-        vector2 p3 = p2 + (dir * length); // Top-right
-        vector2 p4 = p1 + (dir * length); // Top-left
+    [[nodiscard]] Quad getCorners() const {
+        return getBox().corners();
+    }
 
-        return {p1, p2, p3, p4};
+    // Call after changing position, length, width or heading
+    void updateShape() {
+        box = getBox();
+        corners = box.corners();
     }
 
     [[nodiscard]] bool isPointInWall(vector2 vec) const {
-        return isPointInBounds(vec, corners);
+        return corners.contains(vec);
+    }
+
+    [[nodiscard]] bool isRectangleInWall(const Quad& rect) const {
+        return overlaps(rect, corners);
     }
 
-    [[nodiscard]] bool isRectangleInWall(const vectorList_t& rect) const {
-        return isRectangleInRectangle(rect, corners);
+    [[nodiscard]] bool isBoxInWall(const AABB& b) const {
+        return overlaps(b, box);
     }
 };
 
@@ -93,7 +102,7 @@ inline void from_json(const json& j, wall &s) {
     s.length = j.at("l").get<int>();
     s.width = j.at("w").get<int>();
     s.heading = Heading(j.at("h").get<int>());
-    s.corners = s.getCorners();
+    s.updateShape();
 }
 
 inline void to_json(json& j, wall* s) {
@@ -110,7 +119,7 @@ inline void from_json(const json& j, wall* s) {
     s->length = j.at("l").get<int>();
     s->width = j.at("w").get<int>();
     s->heading = Heading(j.at("h").get<int>());
-    s->corners = s->getCorners();
+    s->updateShape();
 }
 
 #endif //CSCI437_WALL_H
@@ -56,6 +56,7 @@ public:
               asepritePath(std::move(imgPath)),
               asepriteJsonPath(std::move(jsonPath))
     {
+        setDormant(true);
         LoadJSON();
     }
     ~AsepriteLoader() override = default;
@@ -69,7 +69,7 @@ private:
 
 public:
     explicit AudioLoader(passFunc_t passFunc, std::string path, bool isMusic_p = false)
-            : xProcess(true, std::move(passFunc)), audioPath(std::move(path)), isMusic(isMusic_p) {}
+            : xProcess(true, std::move(passFunc)), audioPath(std::move(path)), isMusic(isMusic_p) { setDormant(true); }
     ~AudioLoader() override;
 
     int initialize_SDL_process(SDL_Window* window) override;
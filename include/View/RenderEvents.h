@@ -0,0 +1,69 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Peter Greek
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * Proper permission is grated by the copyright holder.
+ *
+ * Credit is attributed to the copyright holder in some form in the product.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+//
+// Created by xerxe on 10/18/2026.
+//
+
+#ifndef CSCI437_RENDEREVENTS_H
+#define CSCI437_RENDEREVENTS_H
+
+#include "vector2.h"
+
+// Typed render primitives, handled by the view. These are fired many times per frame so they skip the
+// json event path entirely: TriggerEvent(SDL::Render::DrawRect{x, y, w, h});
+namespace SDL::Render {
+    struct DrawRect {
+        float x, y, w, h;
+    };
+
+    struct DrawPoint {
+        float x, y;
+    };
+
+    struct DrawPointFromVector {
+        vector2 point;
+    };
+
+    struct SetDrawColor {
+        int r, g, b, a;
+    };
+
+    struct ResetDrawColor {};
+
+    struct DrawCircle {
+        int x, y, radius;
+    };
+
+    struct FillCircle {
+        int x, y, radius;
+    };
+}
+
+#endif //CSCI437_RENDEREVENTS_H
@@ -37,6 +37,7 @@
 #include "xProcess.h"
 #include "GameStorage.h"
 #include "TxdLoader.h"
+#include "RenderEvents.h"
 #include <SDL_ttf.h>
 #include <list>
 #include <string>
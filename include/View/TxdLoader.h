@@ -51,7 +51,7 @@ private:
 public:
     TxdLoader(
             passFunc_t passFunc, std::string txdPath
-    ): xProcess(true, passFunc), txdPath(std::move(txdPath)) {}
+    ): xProcess(true, passFunc), txdPath(std::move(txdPath)) { setDormant(true); }
 
     int initialize_SDL_process(SDL_Window* passed_window) override;
     void update(float deltaMs) override;
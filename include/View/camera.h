@@ -50,7 +50,7 @@ private:
     vector2 CAM_MIN;
     vector2 CAM_MAX;
 public:
-    explicit camera(passFunc_t& func) : xProcess(true, func) {}
+    explicit camera(passFunc_t& func) : xProcess(true, func) { setDormant(true); }
     ~camera() override = default;
 
     int initialize_SDL_process(SDL_Window* window) override;
@@ -68,6 +68,8 @@ public:
     void updateCamera(vector2 pos);
 
     bool isPointInView(vector2 pos) const;
+    vector2 getViewMin() const { return CAM_MIN; }
+    vector2 getViewMax() const { return CAM_MAX; }
     bool isPointInView(float x, float y) const;
 
     vector2 worldToScreenCoords(vector2 pos) const;
@@ -9,6 +9,7 @@
 #include "ChatBox.h"
 #include "ProcessManager.h"
 #include "MainMenu.h"
+#include "RenderEvents.h"
 #include <memory>
 #include <SDL_image.h>
 
@@ -0,0 +1,279 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Peter Greek
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * Proper permission is grated by the copyright holder.
+ *
+ * Credit is attributed to the copyright holder in some form in the product.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+
+//
+// Created by xerxe on 10/18/2026.
+//
+
+#include "CollisionKernels.h"
+#include <cmath>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define UFO_X86_KERNELS 1
+#include <immintrin.h>
+#endif
+
+// Scalar, also the tail after the last full SIMD block
+
+static int firstOverlapScalar(const OBBBatch& b, const AABB& box, size_t begin) {
+    const float c0x = (box.min.x + box.max.x) * 0.5f, c0y = (box.min.y + box.max.y) * 0.5f;
+    const float ex = (box.max.x - box.min.x) * 0.5f, ey = (box.max.y - box.min.y) * 0.5f;
+    for (size_t i = begin; i < b.size(); i++) {
+        const float dx = b.cx[i] - c0x, dy = b.cy[i] - c0y;
+        const float aax = std::fabs(b.ax[i]), aay = std::fabs(b.ay[i]);
+        if (std::fabs(dx) > ex + b.hx[i] * aax + b.hy[i] * aay) continue;
+        if (std::fabs(dy) > ey + b.hx[i] * aay + b.hy[i] * aax) continue;
+        if (std::fabs(dx * b.ax[i] + dy * b.ay[i]) > b.hx[i] + ex * aax + ey * aay) continue;
+        if (std::fabs(dy * b.ax[i] - dx * b.ay[i]) > b.hy[i] + ex * aay + ey * aax) continue;
+        return static_cast<int>(i);
+    }
+    return -1;
+}
+
+static int firstContainingScalar(const OBBBatch& b, vector2 p, size_t begin) {
+    for (size_t i = begin; i < b.size(); i++) {
+        const float dx = p.x - b.cx[i], dy = p.y - b.cy[i];
+        if (std::fabs(dx * b.ax[i] + dy * b.ay[i]) <= b.hx[i] && std::fabs(dy * b.ax[i] - dx * b.ay[i]) <= b.hy[i]) {
+            return static_cast<int>(i);
+        }
+    }
+    return -1;
+}
+
+static void pointsInOBBScalar(const OBB& box, const float* xs, const float* ys, size_t count, uint8_t* out,
+                              size_t begin) {
+    for (size_t i = begin; i < count; i++) {
+        const float dx = xs[i] - box.center.x, dy = ys[i] - box.center.y;
+        out[i] = std::fabs(dx * box.axis.x + dy * box.axis.y) <= box.halfExtents.x
+              && std::fabs(dy * box.axis.x - dx * box.axis.y) <= box.halfExtents.y;
+    }
+}
+
+static int firstOverlapScalarAll(const OBBBatch& b, const AABB& box) { return firstOverlapScalar(b, box, 0); }
+static int firstContainingScalarAll(const OBBBatch& b, vector2 p) { return firstContainingScalar(b, p, 0); }
+static void pointsInOBBScalarAll(const OBB& box, const float* xs, const float* ys, size_t count, uint8_t* out) {
+    pointsInOBBScalar(box, xs, ys, count, out, 0);
+}
+
+#ifdef UFO_X86_KERNELS
+
+// SSE, 4 rows at a time. SSE2 is part of x86-64 so this needs no target attribute there
+
+static inline __m128 abs4(__m128 v) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), v); }
+
+#if defined(__i386__)
+__attribute__((target("sse2")))
+#endif
+static int firstOverlapSSE(const OBBBatch& b, const AABB& box) {
+    const float c0x = (box.min.x + box.max.x) * 0.5f, c0y = (box.min.y + box.max.y) * 0.5f;
+    const __m128 cx0 = _mm_set1_ps(c0x), cy0 = _mm_set1_ps(c0y);
+    const __m128 ex = _mm_set1_ps((box.max.x - box.min.x) * 0.5f), ey = _mm_set1_ps((box.max.y - box.min.y) * 0.5f);
+    size_t i = 0;
+    for (; i + 4 <= b.size(); i += 4) {
+        const __m128 ax = _mm_loadu_ps(&b.ax[i]), ay = _mm_loadu_ps(&b.ay[i]);
+        const __m128 hx = _mm_loadu_ps(&b.hx[i]), hy = _mm_loadu_ps(&b.hy[i]);
+        const __m128 dx = _mm_sub_ps(_mm_loadu_ps(&b.cx[i]), cx0), dy = _mm_sub_ps(_mm_loadu_ps(&b.cy[i]), cy0);
+        const __m128 aax = abs4(ax), aay = abs4(ay);
+
+        __m128 sep = _mm_cmpgt_ps(abs4(dx), _mm_add_ps(ex, _mm_add_ps(_mm_mul_ps(hx, aax), _mm_mul_ps(hy, aay))));
+        sep = _mm_or_ps(sep, _mm_cmpgt_ps(abs4(dy),
+                _mm_add_ps(ey, _mm_add_ps(_mm_mul_ps(hx, aay), _mm_mul_ps(hy, aax)))));
+        sep = _mm_or_ps(sep, _mm_cmpgt_ps(abs4(_mm_add_ps(_mm_mul_ps(dx, ax), _mm_mul_ps(dy, ay))),
+                _mm_add_ps(hx, _mm_add_ps(_mm_mul_ps(ex, aax), _mm_mul_ps(ey, aay)))));
+        sep = _mm_or_ps(sep, _mm_cmpgt_ps(abs4(_mm_sub_ps(_mm_mul_ps(dy, ax), _mm_mul_ps(dx, ay))),
+                _mm_add_ps(hy, _mm_add_ps(_mm_mul_ps(ex, aay), _mm_mul_ps(ey, aax)))));
+
+        int hit = ~_mm_movemask_ps(sep) & 0xF;
+        if (hit) return static_cast<int>(i) + __builtin_ctz(hit);
+    }
+    return firstOverlapScalar(b, box, i);
+}
+
+#if defined(__i386__)
+__attribute__((target("sse2")))
+#endif
+static int firstContainingSSE(const OBBBatch& b, vector2 p) {
+    const __m128 px = _mm_set1_ps(p.x), py = _mm_set1_ps(p.y);
+    size_t i = 0;
+    for (; i + 4 <= b.size(); i += 4) {
+        const __m128 ax = _mm_loadu_ps(&b.ax[i]), ay = _mm_loadu_ps(&b.ay[i]);
+        const __m128 dx = _mm_sub_ps(px, _mm_loadu_ps(&b.cx[i])), dy = _mm_sub_ps(py, _mm_loadu_ps(&b.cy[i]));
+        __m128 in = _mm_cmple_ps(abs4(_mm_add_ps(_mm_mul_ps(dx, ax), _mm_mul_ps(dy, ay))), _mm_loadu_ps(&b.hx[i]));
+        in = _mm_and_ps(in, _mm_cmple_ps(abs4(_mm_sub_ps(_mm_mul_ps(dy, ax), _mm_mul_ps(dx, ay))),
+                                         _mm_loadu_ps(&b.hy[i])));
+        int hit = _mm_movemask_ps(in);
+        if (hit) return static_cast<int>(i) + __builtin_ctz(hit);
+    }
+    return firstContainingScalar(b, p, i);
+}
+
+#if defined(__i386__)
+__attribute__((target("sse2")))
+#endif
+static void pointsInOBBSSE(const OBB& box, const float* xs, const float* ys, size_t count, uint8_t* out) {
+    const __m128 cx = _mm_set1_ps(box.center.x), cy = _mm_set1_ps(box.center.y);
+    const __m128 ax = _mm_set1_ps(box.axis.x), ay = _mm_set1_ps(box.axis.y);
+    const __m128 hx = _mm_set1_ps(box.halfExtents.x), hy = _mm_set1_ps(box.halfExtents.y);
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const __m128 dx = _mm_sub_ps(_mm_loadu_ps(xs + i), cx), dy = _mm_sub_ps(_mm_loadu_ps(ys + i), cy);
+        __m128 in = _mm_cmple_ps(abs4(_mm_add_ps(_mm_mul_ps(dx, ax), _mm_mul_ps(dy, ay))), hx);
+        in = _mm_and_ps(in, _mm_cmple_ps(abs4(_mm_sub_ps(_mm_mul_ps(dy, ax), _mm_mul_ps(dx, ay))), hy));
+        int mask = _mm_movemask_ps(in);
+        for (int k = 0; k < 4; k++) out[i + k] = (mask >> k) & 1;
+    }
+    pointsInOBBScalar(box, xs, ys, count, out, i);
+}
+
+// AVX2, 8 rows at a time
+
+__attribute__((target("avx2")))
+static inline __m256 abs8(__m256 v) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), v); }
+
+__attribute__((target("avx2")))
+static int firstOverlapAVX2(const OBBBatch& b, const AABB& box) {
+    const __m256 cx0 = _mm256_set1_ps((box.min.x + box.max.x) * 0.5f);
+    const __m256 cy0 = _mm256_set1_ps((box.min.y + box.max.y) * 0.5f);
+    const __m256 ex = _mm256_set1_ps((box.max.x - box.min.x) * 0.5f);
+    const __m256 ey = _mm256_set1_ps((box.max.y - box.min.y) * 0.5f);
+    size_t i = 0;
+    for (; i + 8 <= b.size(); i += 8) {
+        const __m256 ax = _mm256_loadu_ps(&b.ax[i]), ay = _mm256_loadu_ps(&b.ay[i]);
+        const __m256 hx = _mm256_loadu_ps(&b.hx[i]), hy = _mm256_loadu_ps(&b.hy[i]);
+        const __m256 dx = _mm256_sub_ps(_mm256_loadu_ps(&b.cx[i]), cx0);
+        const __m256 dy = _mm256_sub_ps(_mm256_loadu_ps(&b.cy[i]), cy0);
+        const __m256 aax = abs8(ax), aay = abs8(ay);
+
+        __m256 sep = _mm256_cmp_ps(abs8(dx),
+                _mm256_add_ps(ex, _mm256_add_ps(_mm256_mul_ps(hx, aax), _mm256_mul_ps(hy, aay))), _CMP_GT_OQ);
+        sep = _mm256_or_ps(sep, _mm256_cmp_ps(abs8(dy),
+                _mm256_add_ps(ey, _mm256_add_ps(_mm256_mul_ps(hx, aay), _mm256_mul_ps(hy, aax))), _CMP_GT_OQ));
+        sep = _mm256_or_ps(sep, _mm256_cmp_ps(abs8(_mm256_add_ps(_mm256_mul_ps(dx, ax), _mm256_mul_ps(dy, ay))),
+                _mm256_add_ps(hx, _mm256_add_ps(_mm256_mul_ps(ex, aax), _mm256_mul_ps(ey, aay))), _CMP_GT_OQ));
+        sep = _mm256_or_ps(sep, _mm256_cmp_ps(abs8(_mm256_sub_ps(_mm256_mul_ps(dy, ax), _mm256_mul_ps(dx, ay))),
+                _mm256_add_ps(hy, _mm256_add_ps(_mm256_mul_ps(ex, aay), _mm256_mul_ps(ey, aax))), _CMP_GT_OQ));
+
+        int hit = ~_mm256_movemask_ps(sep) & 0xFF;
+        if (hit) return static_cast<int>(i) + __builtin_ctz(hit);
+    }
+    return firstOverlapScalar(b, box, i);
+}
+
+__attribute__((target("avx2")))
+static int firstContainingAVX2(const OBBBatch& b, vector2 p) {
+    const __m256 px = _mm256_set1_ps(p.x), py = _mm256_set1_ps(p.y);
+    size_t i = 0;
+    for (; i + 8 <= b.size(); i += 8) {
+        const __m256 ax = _mm256_loadu_ps(&b.ax[i]), ay = _mm256_loadu_ps(&b.ay[i]);
+        const __m256 dx = _mm256_sub_ps(px, _mm256_loadu_ps(&b.cx[i]));
+        const __m256 dy = _mm256_sub_ps(py, _mm256_loadu_ps(&b.cy[i]));
+        __m256 in = _mm256_cmp_ps(abs8(_mm256_add_ps(_mm256_mul_ps(dx, ax), _mm256_mul_ps(dy, ay))),
+                                  _mm256_loadu_ps(&b.hx[i]), _CMP_LE_OQ);
+        in = _mm256_and_ps(in, _mm256_cmp_ps(abs8(_mm256_sub_ps(_mm256_mul_ps(dy, ax), _mm256_mul_ps(dx, ay))),
+                                             _mm256_loadu_ps(&b.hy[i]), _CMP_LE_OQ));
+        int hit = _mm256_movemask_ps(in);
+        if (hit) return static_cast<int>(i) + __builtin_ctz(hit);
+    }
+    return firstContainingScalar(b, p, i);
+}
+
+__attribute__((target("avx2")))
+static void pointsInOBBAVX2(const OBB& box, const float* xs, const float* ys, size_t count, uint8_t* out) {
+    const __m256 cx = _mm256_set1_ps(box.center.x), cy = _mm256_set1_ps(box.center.y);
+    const __m256 ax = _mm256_set1_ps(box.axis.x), ay = _mm256_set1_ps(box.axis.y);
+    const __m256 hx = _mm256_set1_ps(box.halfExtents.x), hy = _mm256_set1_ps(box.halfExtents.y);
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const __m256 dx = _mm256_sub_ps(_mm256_loadu_ps(xs + i), cx);
+        const __m256 dy = _mm256_sub_ps(_mm256_loadu_ps(ys + i), cy);
+        __m256 in = _mm256_cmp_ps(abs8(_mm256_add_ps(_mm256_mul_ps(dx, ax), _mm256_mul_ps(dy, ay))), hx, _CMP_LE_OQ);
+        in = _mm256_and_ps(in, _mm256_cmp_ps(abs8(_mm256_sub_ps(_mm256_mul_ps(dy, ax), _mm256_mul_ps(dx, ay))),
+                                             hy, _CMP_LE_OQ));
+        int mask = _mm256_movemask_ps(in);
+        for (int k = 0; k < 8; k++) out[i + k] = (mask >> k) & 1;
+    }
+    pointsInOBBScalar(box, xs, ys, count, out, i);
+}
+
+#endif // UFO_X86_KERNELS
+
+// Dispatch
+
+struct Kernels {
+    SimdLevel level;
+    int (*firstOverlap)(const OBBBatch&, const AABB&);
+    int (*firstContaining)(const OBBBatch&, vector2);
+    void (*pointsInOBB)(const OBB&, const float*, const float*, size_t, uint8_t*);
+};
+
+static const Kernels scalarKernels = {SimdLevel::SCALAR, firstOverlapScalarAll, firstContainingScalarAll,
+                                      pointsInOBBScalarAll};
+#ifdef UFO_X86_KERNELS
+static const Kernels sseKernels = {SimdLevel::SSE, firstOverlapSSE, firstContainingSSE, pointsInOBBSSE};
+static const Kernels avx2Kernels = {SimdLevel::AVX2, firstOverlapAVX2, firstContainingAVX2, pointsInOBBAVX2};
+#endif
+
+SimdLevel detectSimdLevel() {
+#ifdef UFO_X86_KERNELS
+    __builtin_cpu_init(); // may run before main, from the static below
+    if (__builtin_cpu_supports("avx2")) return SimdLevel::AVX2;
+    if (__builtin_cpu_supports("sse2")) return SimdLevel::SSE;
+#endif
+    return SimdLevel::SCALAR;
+}
+
+static const Kernels* kernelsFor(SimdLevel level) {
+#ifdef UFO_X86_KERNELS
+    SimdLevel best = detectSimdLevel();
+    if (level > best) level = best;
+    if (level == SimdLevel::AVX2) return &avx2Kernels;
+    if (level == SimdLevel::SSE) return &sseKernels;
+#endif
+    return &scalarKernels;
+}
+
+static const Kernels* active = kernelsFor(SimdLevel::AVX2);
+
+int firstOverlap(const OBBBatch& batch, const AABB& box) { return active->firstOverlap(batch, box); }
+int firstContaining(const OBBBatch& batch, vector2 point) { return active->firstContaining(batch, point); }
+void pointsInOBB(const OBB& box, const float* xs, const float* ys, size_t count, uint8_t* out) {
+    active->pointsInOBB(box, xs, ys, count, out);
+}
+
+SimdLevel getSimdLevel() { return active->level; }
+void setSimdLevel(SimdLevel level) { active = kernelsFor(level); }
+
+const char* simdLevelName(SimdLevel level) {
+    switch (level) {
+        case SimdLevel::AVX2: return "avx2";
+        case SimdLevel::SSE: return "sse";
+        default: return "scalar";
+    }
+}
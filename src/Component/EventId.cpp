@@ -0,0 +1,84 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Peter Greek
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * Proper permission is grated by the copyright holder.
+ *
+ * Credit is attributed to the copyright holder in some form in the product.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+//
+// Created by xerxe on 10/18/2026.
+//
+
+#include "EventId.h"
+#include "Util.h"
+#include <unordered_map>
+#include <mutex>
+
+namespace {
+    // id -> name. Only touched when a handler is registered or a dynamic name shows up, never on dispatch.
+    // Locked because worker threads can post events with dynamic names.
+    std::mutex internMutex;
+
+    std::unordered_map<uint32_t, std::string>& internTable() {
+        static std::unordered_map<uint32_t, std::string> table;
+        return table;
+    }
+
+    const char* store(uint32_t id, std::string_view name) {
+        std::lock_guard<std::mutex> lock(internMutex);
+        auto& table = internTable();
+        auto it = table.find(id);
+        if (it == table.end()) {
+            it = table.emplace(id, std::string(name)).first;
+        } else if (it->second != name) {
+            error("EventId collision: ", it->second, " and ", std::string(name), " hash to ", id);
+        }
+        return it->second.c_str();
+    }
+}
+
+EventId EventId::intern(std::string_view name) {
+    uint32_t id = hash(name.data(), name.size());
+    return {id, store(id, name)};
+}
+
+EventId EventId::command(std::string_view command) {
+    constexpr uint32_t prefixHash = hash(COMMAND_PREFIX, sizeof(COMMAND_PREFIX) - 1);
+    uint32_t id = hash(command.data(), command.size(), prefixHash);
+
+    {
+        std::lock_guard<std::mutex> lock(internMutex);
+        auto& table = internTable();
+        auto it = table.find(id);
+        if (it != table.end()) {
+            return {id, it->second.c_str()};
+        }
+    }
+    return {id, store(id, std::string(COMMAND_PREFIX) + std::string(command))};
+}
+
+void EventId::registerName(EventId eventId) {
+    store(eventId.id, eventId.name_);
+}
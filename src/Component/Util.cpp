@@ -47,28 +47,12 @@ int map_range(int s, int a1, int a2, int b1, int b2) {
     return b1 + (s - a1) * (b2 - b1) / (a2 - a1);
 }
 
-vector2 angleToVector2(Heading angle) {
-    float a = static_cast<float>(angle.get());
-    float radians = a * (M_PI / 180.0f);
-
-    // Calculate x and y components
-    float x = std::cos(radians);
-    float y = std::sin(radians);
-
-    // Return normalized vector2
-    return vector2(x, y).normalize();
-}
-
 vector2 angleToVector2(float angle) {
     // Convert degrees to radians
     float radians = angle * (M_PI / 180.0f);
 
-    // Calculate x and y components
-    float x = std::cos(radians);
-    float y = std::sin(radians);
-
-    // Return normalized vector2
-    return vector2(x, y).normalize();
+    // cos and sin are already a unit vector
+    return {std::cos(radians), std::sin(radians)};
 }
 
 Heading getHeadingFromVector(const vector2& v) {
@@ -159,33 +143,13 @@ bool isRectangleInRectangle(const vectorList_t& rect1, const vectorList_t& rect2
 }
 
 bool doLinesIntercept(vector2 v1, vector2 v2, vector2 v3, vector2 v4) {
-    float d = (v4.y - v3.y) * (v2.x - v1.x) - (v4.x - v3.x) * (v2.y - v1.y);
-    float n_a = (v4.x - v3.x) * (v1.y - v3.y) - (v4.y - v3.y) * (v1.x - v3.x);
-    float n_b = (v2.x - v1.x) * (v1.y - v3.y) - (v2.y - v1.y) * (v1.x - v3.x);
-
-    if (d == 0) {
-        return false;
-    }
-
-    float ua = n_a / d;
-    float ub = n_b / d;
-
-    return ua >= 0 && ua <= 1 && ub >= 0 && ub <= 1;
+    float ua;
+    return segmentIntercept(v1, v2, v3, v4, ua);
 }
 
 int getInterceptDist(vector2 v1, vector2 v2, vector2 v3, vector2 v4) {
-    float d = (v4.y - v3.y) * (v2.x - v1.x) - (v4.x - v3.x) * (v2.y - v1.y);
-    float n_a = (v4.x - v3.x) * (v1.y - v3.y) - (v4.y - v3.y) * (v1.x - v3.x);
-    float n_b = (v2.x - v1.x) * (v1.y - v3.y) - (v2.y - v1.y) * (v1.x - v3.x);
-
-    if (d == 0) {
-        return -1;
-    }
-
-    float ua = n_a / d;
-    float ub = n_b / d;
-
-    if (ua >= 0 && ua <= 1 && ub >= 0 && ub <= 1) {
+    float ua;
+    if (segmentIntercept(v1, v2, v3, v4, ua)) {
         return ua * (v2 - v1).length();
     }
 
@@ -257,6 +221,11 @@ uint32_t jenkinsOneAtATimeHash(const std::string& key) {
     return hash;
 }
 
+// Debug / chat form of a process id: pm-<index>-<generation>
+std::string formatProcessId(ProcessId_t id) {
+    return "pm-" + std::to_string(id & 0xFFFFFFFFu) + "-" + std::to_string(id >> 32);
+}
+
 int mapHashToRange(uint32_t hash, int min, int max) {
     return (hash % (max - min + 1)) + min;
 }
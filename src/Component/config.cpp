@@ -36,8 +36,10 @@
 // Define global variables
 bool unlimitedFrames = false;
 int debugMode = 0;
+bool headlessMode = false;
 int curRoomIndex = -1;
 int targetFPS = 90;
+int simulationRate = 90; // matches the default targetFPS the game was tuned at
 
 int BASE_SCREEN_WIDTH = 1024; // DO NOT CHANGE THESE VALUES (WHAT THE GAME IS BASED ON IN INIT DEVELOPMENT)
 int BASE_SCREEN_HEIGHT = 768; // DO NOT CHANGE THESE VALUES (WHAT THE GAME IS BASED ON IN INIT DEVELOPMENT)
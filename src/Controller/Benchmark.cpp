@@ -0,0 +1,580 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Peter Greek
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * Proper permission is grated by the copyright holder.
+ *
+ * Credit is attributed to the copyright holder in some form in the product.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+//
+// Created by xerxe on 10/18/2026.
+//
+
+#include "Benchmark.h"
+#include "ProcessManager.h"
+#include "MPSCQueue.h"
+#include "TimerWheel.h"
+#include "SpatialHash.h"
+#include "wall.h"
+#include "CollisionKernels.h"
+#include <chrono>
+#include <thread>
+#include <atomic>
+#include <sstream>
+#include <iomanip>
+#include <cmath>
+#include <cstdlib>
+#include <algorithm>
+#include <stdexcept>
+
+using benchClock = std::chrono::steady_clock;
+
+int Benchmark::initialize() {
+    RegisterCommand("benchEvents", [this](std::string command, sList_t args, std::string message) {
+        benchEventDispatch();
+    });
+
+    RegisterCommand("benchParallelUpdate", [this](std::string command, sList_t args, std::string message) {
+        benchParallelUpdate();
+    });
+
+    RegisterCommand("benchPostQueue", [this](std::string command, sList_t args, std::string message) {
+        const std::string usage = "benchPostQueue [producers] [perProducer]";
+        int producers, perProducer;
+        if (!countArg(args, 0, 8, 64, producers, usage) || !countArg(args, 1, 100000, 10000000, perProducer, usage)) {
+            return;
+        }
+        benchPostQueue(producers, perProducer);
+    });
+
+    RegisterCommand("benchTimers", [this](std::string command, sList_t args, std::string message) {
+        int count;
+        if (countArg(args, 0, 100000, 10000000, count, "benchTimers [count]")) benchTimers(count);
+    });
+
+    RegisterCommand("benchSpatialHash", [this](std::string command, sList_t args, std::string message) {
+        benchSpatialHash();
+    });
+
+    RegisterCommand("benchGeometry", [this](std::string command, sList_t args, std::string message) {
+        int count;
+        if (countArg(args, 0, 200000, 10000000, count, "benchGeometry [count]")) benchGeometry(count);
+    });
+
+    RegisterCommand("benchCollisionKernels", [this](std::string command, sList_t args, std::string message) {
+        int walls;
+        if (countArg(args, 0, 256, 100000, walls, "benchCollisionKernels [walls]")) benchCollisionKernels(walls);
+    });
+
+    RegisterCommand("benchTrig", [this](std::string command, sList_t args, std::string message) {
+        int count;
+        if (countArg(args, 0, 1000000, 50000000, count, "benchTrig [count]")) benchTrig(count);
+    });
+
+    return 1;
+}
+
+void Benchmark::report(const std::string& line) {
+    print(line);
+    TriggerEvent("UFO::Chat::AddMessage", line);
+}
+
+// args[index] as a count clamped to 1..max, fallback when it isn't given. Anything that isn't a whole number gets
+// the usage message and false, so a typo can't throw out of the chat handler
+bool Benchmark::countArg(const sList_t& args, size_t index, int fallback, int max, int& out, const std::string& usage) {
+    out = fallback;
+    if (index >= args.size()) return true;
+    try {
+        size_t used = 0;
+        long long value = std::stoll(args[index], &used);
+        if (used == args[index].size()) {
+            out = static_cast<int>(std::clamp<long long>(value, 1, max));
+            return true;
+        }
+    } catch (const std::invalid_argument&) {
+    } catch (const std::out_of_range&) {
+    }
+    TriggerEvent("UFO::Chat::AddMessage", "Incorrect Usage: " + usage);
+    return false;
+}
+
+// Dispatch cost vs process count. Only a handful of processes listen to the event, the rest are idle
+// (like AT, projectiles and text). "indexed" goes through the ProcessManager subscriber index, "broadcast" is the
+// old walk over every process.
+void Benchmark::benchEventDispatch() {
+    class idleProcess : public xProcess {
+    public:
+        idleProcess(passFunc_t func, bool listening) : xProcess(false, std::move(func)) {
+            AddEventHandler("UFO::Bench::Idle", []() {});
+            if (listening) {
+                AddEventHandler("UFO::Bench::Tick", [this](int value) { hits += value; });
+            }
+        }
+        void update(float deltaMs) override {}
+        bool isDone() override { return false; }
+        int hits = 0;
+    };
+
+    const int listeners = 8;
+    const int dispatches = 2000;
+    const json eventData = json::array({1});
+
+    report("benchEvents: processes, indexed us/event, broadcast us/event");
+    for (int count : {10, 100, 1000, 5000}) {
+        ProcessManager pm;
+        passFunc_t func = [&pm](EventId eventId, const json& data) { pm.triggerEventInAll(eventId, data); };
+
+        std::vector<std::shared_ptr<idleProcess>> processes;
+        processes.reserve(count);
+        for (int i = 0; i < count; i++) {
+            auto p = std::make_shared<idleProcess>(func, i % (count / listeners + 1) == 0);
+            processes.push_back(p);
+            pm.attachProcess(p);
+        }
+
+        auto start = benchClock::now();
+        for (int i = 0; i < dispatches; i++) {
+            pm.triggerEventInAll("UFO::Bench::Tick", eventData);
+        }
+        double indexed = std::chrono::duration<double, std::micro>(benchClock::now() - start).count() / dispatches;
+
+        start = benchClock::now();
+        for (int i = 0; i < dispatches; i++) {
+            for (auto& p : processes) {
+                if (p->dead()) continue;
+                p->onTriggerEvent("UFO::Bench::Tick", eventData);
+            }
+        }
+        double broadcast = std::chrono::duration<double, std::micro>(benchClock::now() - start).count() / dispatches;
+
+        std::ostringstream line;
+        line << std::fixed << std::setprecision(3) << count << ", " << indexed << ", " << broadcast;
+        report(line.str());
+        pm.abortAllProcess();
+    }
+}
+
+// Stress test for the MPSC queue behind EventQueue::post. Producer threads push (producer, sequence) pairs while
+// this thread drains, then checks nothing was lost, duplicated or reordered within a producer.
+void Benchmark::benchPostQueue(int producers, int perProducer) {
+    MPSCQueue<std::pair<int, int>> queue;
+    std::atomic<bool> go{false};
+    std::vector<std::thread> threads;
+    threads.reserve(producers);
+
+    for (int p = 0; p < producers; p++) {
+        threads.emplace_back([&queue, &go, p, perProducer]() {
+            while (!go.load(std::memory_order_acquire)) {}
+            for (int i = 0; i < perProducer; i++) {
+                queue.push({p, i});
+            }
+        });
+    }
+
+    std::vector<int> nextExpected(producers, 0);
+    long long total = (long long)producers * perProducer;
+    long long received = 0;
+    bool ordered = true;
+
+    auto start = benchClock::now();
+    go.store(true, std::memory_order_release);
+    std::pair<int, int> item;
+    while (received < total) {
+        if (!queue.pop(item)) continue;
+        if (item.second != nextExpected[item.first]) ordered = false;
+        nextExpected[item.first] = item.second + 1;
+        received++;
+    }
+    double ms = std::chrono::duration<double, std::milli>(benchClock::now() - start).count();
+
+    for (auto& t : threads) t.join();
+
+    std::ostringstream line;
+    line << std::fixed << std::setprecision(2) << "benchPostQueue: " << producers << " producers, " << received
+         << " events in " << ms << " ms (" << (received / ms / 1000.0) << " M/s), "
+         << (ordered && queue.empty() ? "ok" : "FAILED");
+    report(line.str());
+}
+
+// updateProcessList cost with thread-safe updates run serially vs on the job system. Each process does a fixed
+// amount of private math, roughly what a laser or a knocked back enemy costs per frame.
+void Benchmark::benchParallelUpdate() {
+    class busyProcess : public xProcess {
+    public:
+        explicit busyProcess(passFunc_t func) : xProcess(false, std::move(func)) {}
+        void update(float deltaMs) override {
+            for (int i = 0; i < 200; i++) {
+                value = value * 0.999f + std::sin(value + deltaMs);
+            }
+        }
+        [[nodiscard]] bool threadSafeUpdate() const override { return true; }
+        bool isDone() override { return false; }
+        float value = 1.0f;
+    };
+
+    const int frames = 20;
+    passFunc_t func = [](EventId, const json&) {};
+
+    report("benchParallelUpdate: processes, serial ms/frame, parallel ms/frame, threads " +
+           std::to_string(JobSystem::defaultWorkerCount() + 1));
+    for (int count : {100, 1000, 10000, 50000}) {
+        ProcessManager pm;
+        for (int i = 0; i < count; i++) {
+            pm.attachProcess(std::make_shared<busyProcess>(func));
+        }
+        pm.updateProcessList(1.0f, nullptr); // initialize everything
+
+        double results[2];
+        for (int parallel = 0; parallel < 2; parallel++) {
+            pm.setParallelUpdates(parallel == 1);
+            auto start = benchClock::now();
+            for (int f = 0; f < frames; f++) {
+                pm.updateProcessList(1.0f, nullptr);
+            }
+            results[parallel] = std::chrono::duration<double, std::milli>(benchClock::now() - start).count() / frames;
+        }
+
+        std::ostringstream line;
+        line << std::fixed << std::setprecision(3) << count << ", " << results[0] << ", " << results[1];
+        report(line.str());
+        pm.abortAllProcess();
+    }
+}
+
+// Timer wheel cost per timer: schedule count one-shot timers spread over 10 s (half get cancelled, like cooldowns
+// that end early) then run the wheel forward at 60 fps until everything has fired.
+void Benchmark::benchTimers(int count) {
+    TimerWheel wheel;
+    std::vector<SlotHandle> handles;
+    handles.reserve(count);
+    int fired = 0;
+
+    auto start = benchClock::now();
+    for (int i = 0; i < count; i++) {
+        handles.push_back(wheel.add(1 + (uint64_t)(i * 7919) % 10000, [&fired]() { fired++; }));
+    }
+    double addNs = std::chrono::duration<double, std::nano>(benchClock::now() - start).count() / count;
+
+    start = benchClock::now();
+    for (int i = 0; i < count; i += 2) {
+        wheel.cancel(handles[i]);
+    }
+    double cancelNs = std::chrono::duration<double, std::nano>(benchClock::now() - start).count() / (count / 2 + 1);
+
+    start = benchClock::now();
+    int frames = 0;
+    while (wheel.size() > 0) {
+        wheel.advance(1000.0 / 60.0);
+        frames++;
+    }
+    double advanceMs = std::chrono::duration<double, std::milli>(benchClock::now() - start).count();
+
+    std::ostringstream line;
+    line << std::fixed << std::setprecision(1) << "benchTimers: " << count << " timers, add " << addNs
+         << " ns, cancel " << cancelNs << " ns, fired " << fired << " over " << frames << " frames, "
+         << (advanceMs * 1000.0 / frames) << " us/frame";
+    report(line.str());
+}
+
+// Overlap pairs per step for 100 to 50k entity sized boxes at a fixed density (about one per 64 unit cell, busier
+// than a real room). "naive" is the entityList walk the GameManager handlers used to do for every entity, "grid"
+// moves every box and then runs one AABB query per box. The naive pass is skipped above 10k, where one step takes seconds.
+void Benchmark::benchSpatialHash() {
+    for (int count : {100, 1000, 10000, 50000}) {
+        float side = std::sqrt(static_cast<float>(count)) * 64.0f;
+        std::vector<vector2> pos(count);
+        std::vector<vector2> vel(count);
+        for (int i = 0; i < count; i++) {
+            pos[i] = {static_cast<float>(rand()) / RAND_MAX * side, static_cast<float>(rand()) / RAND_MAX * side};
+            vel[i] = {static_cast<float>(rand() % 9 - 4), static_cast<float>(rand() % 9 - 4)};
+        }
+        const vector2 half(8.0f, 8.0f);
+        const int steps = 10;
+
+        long long naivePairs = 0;
+        double naiveMs = -1.0;
+        if (count <= 10000) {
+            auto start = benchClock::now();
+            for (int s = 0; s < steps; s++) {
+                for (int i = 0; i < count; i++) {
+                    for (int j = i + 1; j < count; j++) {
+                        if (std::abs(pos[i].x - pos[j].x) <= 16.0f && std::abs(pos[i].y - pos[j].y) <= 16.0f) {
+                            naivePairs++;
+                        }
+                    }
+                }
+            }
+            naiveMs = std::chrono::duration<double, std::milli>(benchClock::now() - start).count() / steps;
+        }
+
+        SpatialHash<uint32_t> grid(64.0f);
+        std::vector<uint32_t> ids(count);
+        auto start = benchClock::now();
+        for (int i = 0; i < count; i++) {
+            ids[i] = grid.insert(static_cast<uint32_t>(i), pos[i] - half, pos[i] + half);
+        }
+        double buildMs = std::chrono::duration<double, std::milli>(benchClock::now() - start).count();
+
+        // the first step re-queries the starting layout so its pair count can be checked against the naive pass
+        long long gridPairs = 0;
+        long long firstStepPairs = 0;
+        std::vector<uint32_t> found;
+        start = benchClock::now();
+        for (int s = 0; s < steps; s++) {
+            if (s > 0) {
+                for (int i = 0; i < count; i++) {
+                    pos[i] += vel[i];
+                    grid.move(ids[i], pos[i] - half, pos[i] + half);
+                }
+            }
+            for (int i = 0; i < count; i++) {
+                found.clear();
+                grid.queryAABB(pos[i] - half, pos[i] + half, found);
+                for (uint32_t id : found) {
+                    if (grid.get(id) > static_cast<uint32_t>(i)) gridPairs++;
+                }
+            }
+            if (s == 0) firstStepPairs = gridPairs;
+        }
+        double gridMs = std::chrono::duration<double, std::milli>(benchClock::now() - start).count() / steps;
+
+        std::ostringstream line;
+        line << std::fixed << std::setprecision(3) << "benchSpatialHash: " << count << " entities, ";
+        if (naiveMs >= 0.0) {
+            line << "naive " << naiveMs << " ms/step, ";
+        } else {
+            line << "naive skipped, ";
+        }
+        line << "grid build " << buildMs << " ms, move+query " << gridMs << " ms/step";
+        if (naiveMs >= 0.0) {
+            line << ((naivePairs / steps == firstStepPairs) ? ", pairs match (" : ", PAIRS DIFFER (")
+                 << firstStepPairs << ")";
+        }
+        report(line.str());
+    }
+}
+
+// Cost per collision test, old vectorList_t helpers against the Geometry.h value types. "before" builds its
+// vectors per test the way the callers did (entityCorners, isPointInEntity); both sides must agree on every hit.
+void Benchmark::benchGeometry(int count) {
+    struct Case {
+        vector2 center;
+        vector2 half;
+        vector2 point;
+        wall w;
+    };
+    std::vector<Case> cases(count);
+    for (auto& c : cases) {
+        c.center = {static_cast<float>(rand() % 400), static_cast<float>(rand() % 400)};
+        c.half = {static_cast<float>(rand() % 20 + 4), static_cast<float>(rand() % 20 + 4)};
+        c.point = {static_cast<float>(rand() % 400) + 0.5f, static_cast<float>(rand() % 400) + 0.5f};
+        c.w = wall({static_cast<float>(rand() % 400), static_cast<float>(rand() % 400)}, rand() % 200 + 10,
+                   rand() % 20 + 4, Heading(rand() % 360));
+    }
+    std::vector<vectorList_t> oldCorners(count);
+    for (int i = 0; i < count; i++) {
+        oldCorners[i].assign(cases[i].w.corners.begin(), cases[i].w.corners.end());
+    }
+
+    auto nsPer = [count](benchClock::time_point start) {
+        return std::chrono::duration<double, std::nano>(benchClock::now() - start).count() / count;
+    };
+
+    int oldHits = 0;
+    auto start = benchClock::now();
+    for (int i = 0; i < count; i++) {
+        const Case& c = cases[i];
+        vectorList_t rect;
+        rect.push_back(c.center + vector2(-c.half.x, -c.half.y));
+        rect.push_back(c.center + vector2(-c.half.x, c.half.y));
+        rect.push_back(c.center + vector2(c.half.x, c.half.y));
+        rect.push_back(c.center + vector2(c.half.x, -c.half.y));
+        oldHits += isRectangleInRectangle(rect, oldCorners[i]);
+    }
+    double oldBoxNs = nsPer(start);
+
+    int quadHits = 0;
+    start = benchClock::now();
+    for (int i = 0; i < count; i++) {
+        const Case& c = cases[i];
+        quadHits += overlaps(Quad::fromAABB(AABB::fromCenter(c.center, c.half)), c.w.corners);
+    }
+    double quadNs = nsPer(start);
+
+    int obbHits = 0;
+    start = benchClock::now();
+    for (int i = 0; i < count; i++) {
+        const Case& c = cases[i];
+        obbHits += c.w.isBoxInWall(AABB::fromCenter(c.center, c.half));
+    }
+    double obbNs = nsPer(start);
+
+    int oldPointHits = 0;
+    start = benchClock::now();
+    for (int i = 0; i < count; i++) {
+        const Case& c = cases[i];
+        oldPointHits += isPointInBounds(c.point, {c.center + vector2(-c.half.x, c.half.y),
+                                                  c.center + vector2(c.half.x, c.half.y),
+                                                  c.center + vector2(c.half.x, -c.half.y),
+                                                  c.center + vector2(-c.half.x, -c.half.y)});
+    }
+    double oldPointNs = nsPer(start);
+
+    int pointHits = 0;
+    start = benchClock::now();
+    for (int i = 0; i < count; i++) {
+        const Case& c = cases[i];
+        pointHits += Quad::fromAABB(AABB::fromCenter(c.center, c.half)).contains(c.point);
+    }
+    double pointNs = nsPer(start);
+
+    std::ostringstream line;
+    line << std::fixed << std::setprecision(1) << "benchGeometry: " << count << " tests, box vs wall "
+         << oldBoxNs << " ns (vectors) / " << quadNs << " ns (Quad SAT) / " << obbNs << " ns (AABB vs OBB), "
+         << "point in box " << oldPointNs << " ns / " << pointNs << " ns, hits "
+         << oldHits << "/" << quadHits << "/" << obbHits << " and " << oldPointHits << "/" << pointHits;
+    report(line.str());
+}
+
+// The batch kernels at each SIMD level the CPU has. "box" asks whether an entity box hits any wall packed in one
+// OBBBatch, the same question world::isRectInWall asks of a grid cell; "points" tests a cloud of entity centers
+// against one long laser box. "loop" answers the box question with wall::isBoxInWall per wall.
+void Benchmark::benchCollisionKernels(int walls) {
+    auto randomFloat = [](float lo, float hi) {
+        return lo + (hi - lo) * static_cast<float>(rand()) / static_cast<float>(RAND_MAX);
+    };
+
+    std::vector<wall> wallList;
+    OBBBatch batch;
+    wallList.reserve(walls);
+    for (int i = 0; i < walls; i++) {
+        wallList.emplace_back(vector2(randomFloat(0, 2000), randomFloat(0, 2000)), rand() % 300 + 20, rand() % 40 + 4,
+                              rand() % 360);
+        batch.push(wallList.back().box, i);
+    }
+
+    const int queries = 2000;
+    std::vector<AABB> boxes;
+    boxes.reserve(queries);
+    for (int i = 0; i < queries; i++) {
+        boxes.push_back(AABB::fromCenter({randomFloat(0, 2000), randomFloat(0, 2000)},
+                                         {randomFloat(8, 40), randomFloat(8, 40)}));
+    }
+
+    const size_t points = 100000;
+    std::vector<float> xs(points), ys(points);
+    std::vector<uint8_t> inside(points);
+    for (size_t i = 0; i < points; i++) {
+        xs[i] = randomFloat(0, 2000);
+        ys[i] = randomFloat(0, 2000);
+    }
+    OBB laser = OBB::fromSegment({100, 100}, angleToVector2(35), 2500, 40);
+
+    auto nsSince = [](benchClock::time_point start, size_t tests) {
+        return std::chrono::duration<double, std::nano>(benchClock::now() - start).count() / static_cast<double>(tests);
+    };
+
+    int loopHits = 0;
+    auto start = benchClock::now();
+    for (const AABB& box : boxes) {
+        for (const wall& w : wallList) {
+            if (w.isBoxInWall(box)) {
+                loopHits++;
+                break;
+            }
+        }
+    }
+    double loopNs = nsSince(start, queries);
+
+    std::ostringstream line;
+    line << std::fixed << std::setprecision(2) << "benchCollisionKernels: " << walls << " walls, box vs walls ns, "
+         << points << " points vs laser ns/point. loop " << loopNs << " ns (" << loopHits << " hits)";
+
+    SimdLevel previous = getSimdLevel();
+    for (SimdLevel level : {SimdLevel::SCALAR, SimdLevel::SSE, SimdLevel::AVX2}) {
+        setSimdLevel(level);
+        if (getSimdLevel() != level) continue; // not on this CPU
+
+        int hits = 0;
+        start = benchClock::now();
+        for (const AABB& box : boxes) hits += firstOverlap(batch, box) >= 0;
+        double boxNs = nsSince(start, queries);
+
+        start = benchClock::now();
+        pointsInOBB(laser, xs.data(), ys.data(), points, inside.data());
+        double pointNs = nsSince(start, points);
+        int pointHits = 0;
+        for (uint8_t in : inside) pointHits += in;
+
+        line << ", " << simdLevelName(level) << " " << boxNs << " / " << pointNs << " ns (" << hits << "/"
+             << pointHits << " hits)";
+    }
+    setSimdLevel(previous);
+    report(line.str());
+}
+
+// angleToVector2 over random headings. "old" is the version before the table (cos, sin, then normalize), "float"
+// is the fractional degree overload without the normalize, "table" is the Heading overload. The error is the
+// table's worst component against double precision sin / cos.
+void Benchmark::benchTrig(int count) {
+    auto oldAngleToVector2 = [](float angle) {
+        float radians = angle * (M_PI / 180.0f);
+        return vector2(std::cos(radians), std::sin(radians)).normalize();
+    };
+
+    std::vector<Heading> headings;
+    headings.reserve(count);
+    for (int i = 0; i < count; i++) headings.emplace_back(rand() % 361);
+
+    auto nsPer = [count](benchClock::time_point start) {
+        return std::chrono::duration<double, std::nano>(benchClock::now() - start).count() / count;
+    };
+
+    vector2 sum;
+    auto start = benchClock::now();
+    for (Heading h : headings) sum += oldAngleToVector2(static_cast<float>(h.get()));
+    double oldNs = nsPer(start);
+
+    start = benchClock::now();
+    for (Heading h : headings) sum += angleToVector2(static_cast<float>(h.get()));
+    double floatNs = nsPer(start);
+
+    start = benchClock::now();
+    for (Heading h : headings) sum += angleToVector2(h);
+    double tableNs = nsPer(start);
+
+    double maxError = 0;
+    for (int d = 0; d <= 360; d++) {
+        double radians = d * M_PI / 180.0;
+        vector2 v = angleToVector2(Heading(d));
+        maxError = std::max({maxError, std::fabs(v.x - std::cos(radians)), std::fabs(v.y - std::sin(radians))});
+    }
+
+    std::ostringstream line;
+    line << std::fixed << std::setprecision(2) << "benchTrig: " << count << " headings, old " << oldNs
+         << " ns / float " << floatNs << " ns / table " << tableNs << " ns, table max error " << std::scientific
+         << std::setprecision(1) << maxError << ", sizeof Heading " << sizeof(Heading) << " (was "
+         << sizeof(BoundedInt) << "), checksum " << std::defaultfloat << sum.x + sum.y;
+    report(line.str());
+}
@@ -0,0 +1,124 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Peter Greek
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * Proper permission is grated by the copyright holder.
+ *
+ * Credit is attributed to the copyright holder in some form in the product.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+//
+// Created by xerxe on 10/18/2026.
+//
+
+#include "EventProfiler.h"
+#include <unordered_map>
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+
+namespace {
+    uint64_t profiledFrames = 0;
+    uint64_t totalUpdateCalls = 0;
+    uint64_t totalDormantSkipped = 0;
+
+    std::unordered_map<uint32_t, EventProfiler::Stats>& statsTable() {
+        static std::unordered_map<uint32_t, EventProfiler::Stats> table;
+        return table;
+    }
+
+    EventProfiler::Stats& statsFor(EventId eventId) {
+        auto& stats = statsTable()[eventId.value()];
+        stats.name = eventId.name();
+        return stats;
+    }
+}
+
+void EventProfiler::recordDispatch(EventId eventId, const json& eventData) {
+    auto& stats = statsFor(eventId);
+    size_t bytes = eventData.dump().size();
+    stats.dispatches++;
+    stats.payloadBytes += bytes;
+    stats.maxPayloadBytes = std::max(stats.maxPayloadBytes, bytes);
+}
+
+void EventProfiler::recordHandler(EventId eventId, clock_t::time_point start) {
+    double ms = std::chrono::duration<double, std::milli>(clock_t::now() - start).count();
+    auto& stats = statsFor(eventId);
+    stats.handlers++;
+    stats.totalMs += ms;
+    stats.maxMs = std::max(stats.maxMs, ms);
+}
+
+std::vector<EventProfiler::Stats> EventProfiler::snapshot() {
+    std::vector<Stats> result;
+    result.reserve(statsTable().size());
+    for (auto& [id, stats] : statsTable()) {
+        result.push_back(stats);
+    }
+    std::sort(result.begin(), result.end(), [](const Stats& a, const Stats& b) { return a.totalMs > b.totalMs; });
+    return result;
+}
+
+void EventProfiler::reset() {
+    statsTable().clear();
+    profiledFrames = 0;
+    totalUpdateCalls = 0;
+    totalDormantSkipped = 0;
+}
+
+void EventProfiler::recordFrameUpdates(size_t updateCalls, size_t dormantSkipped) {
+    profiledFrames++;
+    totalUpdateCalls += updateCalls;
+    totalDormantSkipped += dormantSkipped;
+}
+
+std::string EventProfiler::frameUpdateSummary() {
+    if (profiledFrames == 0) return "update calls/frame: no frames recorded";
+    double calls = (double)totalUpdateCalls / profiledFrames;
+    double skipped = (double)totalDormantSkipped / profiledFrames;
+    double saved = calls + skipped > 0 ? skipped * 100.0 / (calls + skipped) : 0;
+    std::ostringstream out;
+    out << std::fixed << std::setprecision(1) << "update calls/frame: " << calls << ", dormant skipped: " << skipped
+        << " (" << saved << "% fewer)";
+    return out.str();
+}
+
+bool EventProfiler::dumpCsv(const std::string& path) {
+    std::ofstream file(path);
+    if (!file.is_open()) {
+        print("Failed to open event profile file: ", path);
+        return false;
+    }
+
+    file << "event,dispatches,handlers,total_ms,max_ms,avg_payload_bytes,max_payload_bytes\n";
+    for (auto& stats : snapshot()) {
+        double avgPayload = stats.dispatches > 0 ? (double)stats.payloadBytes / stats.dispatches : 0;
+        file << '"' << stats.name << "\"," << stats.dispatches << ',' << stats.handlers << ','
+             << stats.totalMs << ',' << stats.maxMs << ',' << avgPayload << ',' << stats.maxPayloadBytes << '\n';
+    }
+    print("Event profile written to: ", path);
+    print(frameUpdateSummary());
+    return true;
+}
@@ -0,0 +1,158 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Peter Greek
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * Proper permission is grated by the copyright holder.
+ *
+ * Credit is attributed to the copyright holder in some form in the product.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+//
+// Created by xerxe on 10/18/2026.
+//
+
+#include "FramePacer.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <sstream>
+#include <thread>
+
+#ifdef _WIN32
+#include <windows.h>
+#ifndef CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+#define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION 0x00000002
+#endif
+#else
+#include <ctime>
+#endif
+
+FramePacer::FramePacer() {
+#ifdef _WIN32
+    // Windows 10 1803+, older versions return null and we fall back to sleep_for
+    highResTimer = CreateWaitableTimerExW(nullptr, nullptr, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+#endif
+}
+
+FramePacer::~FramePacer() {
+#ifdef _WIN32
+    if (highResTimer) CloseHandle(highResTimer);
+#endif
+}
+
+void FramePacer::sleepFor(double ms) {
+#ifdef _WIN32
+    if (highResTimer) {
+        LARGE_INTEGER due;
+        due.QuadPart = -static_cast<LONGLONG>(ms * 10000.0); // relative, in 100 ns units
+        if (SetWaitableTimerEx(highResTimer, &due, 0, nullptr, nullptr, nullptr, 0)) {
+            WaitForSingleObject(highResTimer, INFINITE);
+            return;
+        }
+    }
+#endif
+    std::this_thread::sleep_for(std::chrono::duration<double, std::milli>(ms)); // nanosleep on Linux / macOS
+}
+
+void FramePacer::waitUntil(Uint64 deadline) {
+    Uint64 now = SDL_GetPerformanceCounter();
+    if (now >= deadline) return;
+
+    if (mode == SPIN) {
+        double waitTime = static_cast<double>(deadline - now) * 1000.0 / clocksPerSecond;
+        if (waitTime > 1.0) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(static_cast<int>(waitTime - 1.0)));
+        }
+    } else {
+        double requestMs = static_cast<double>(deadline - now) * 1000.0 / clocksPerSecond - sleepMarginMs;
+        if (requestMs > 0.05) {
+            Uint64 before = SDL_GetPerformanceCounter();
+            sleepFor(requestMs);
+            double slept = static_cast<double>(SDL_GetPerformanceCounter() - before) * 1000.0 / clocksPerSecond;
+
+            double overshoot = std::max(0.0, slept - requestMs);
+            double diff = overshoot - overshootMean;
+            overshootMean += 0.1 * diff;
+            overshootVar = 0.9 * (overshootVar + 0.1 * diff * diff);
+            sleepMarginMs = std::clamp(overshootMean + 2.0 * std::sqrt(overshootVar), 0.1, 4.0);
+        }
+    }
+
+    while (SDL_GetPerformanceCounter() < deadline) {}
+}
+
+void FramePacer::recordFrame(double intervalMs) {
+    double cpuMs = threadCpuMs();
+    if (lastCpuMs >= 0) {
+        frames++;
+        intervalSum += intervalMs;
+        intervalSumSq += intervalMs * intervalMs;
+        intervalMax = std::max(intervalMax, intervalMs);
+        cpuSum += cpuMs - lastCpuMs;
+    }
+    lastCpuMs = cpuMs;
+}
+
+void FramePacer::resetStats() {
+    frames = 0;
+    intervalSum = 0;
+    intervalSumSq = 0;
+    intervalMax = 0;
+    cpuSum = 0;
+    lastCpuMs = -1;
+}
+
+std::string FramePacer::report() const {
+    std::ostringstream out;
+    out << "pacing " << (mode == SPIN ? "spin" : "adaptive") << ": ";
+    if (frames == 0) {
+        out << "no frames recorded";
+        return out.str();
+    }
+
+    double mean = intervalSum / frames;
+    double jitter = std::sqrt(std::max(0.0, intervalSumSq / frames - mean * mean));
+    double cpu = cpuSum / frames;
+    out << std::fixed << std::setprecision(3) << frames << " frames, frame " << mean << " ms, jitter " << jitter
+        << " ms (max " << intervalMax << "), cpu " << cpu << " ms/frame (" << std::setprecision(1)
+        << (mean > 0 ? cpu * 100.0 / mean : 0) << "%), sleep margin " << std::setprecision(3) << sleepMarginMs
+        << " ms";
+    return out.str();
+}
+
+// CPU time of the main thread, so loader and job system threads do not count against the frame
+double FramePacer::threadCpuMs() {
+#ifdef _WIN32
+    FILETIME creation, exitTime, kernel, user;
+    if (!GetThreadTimes(GetCurrentThread(), &creation, &exitTime, &kernel, &user)) return 0;
+    ULARGE_INTEGER k, u;
+    k.LowPart = kernel.dwLowDateTime; k.HighPart = kernel.dwHighDateTime;
+    u.LowPart = user.dwLowDateTime; u.HighPart = user.dwHighDateTime;
+    return static_cast<double>(k.QuadPart + u.QuadPart) / 10000.0;
+#else
+    timespec ts{};
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return static_cast<double>(ts.tv_sec) * 1000.0 + static_cast<double>(ts.tv_nsec) / 1e6;
+#endif
+}
@@ -0,0 +1,140 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Peter Greek
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * Proper permission is grated by the copyright holder.
+ *
+ * Credit is attributed to the copyright holder in some form in the product.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+//
+// Created by xerxe on 10/18/2026.
+//
+
+#include "FrameTimer.h"
+#include "Util.h"
+#include <algorithm>
+#include <fstream>
+
+namespace {
+    constexpr size_t COLUMNS = FrameTimer::PHASE_COUNT + 1; // phases then the frame total
+
+    float samples[FrameTimer::CAPACITY][COLUMNS] = {};
+    float current[COLUMNS] = {};
+    size_t head = 0; // next row to write
+    size_t filled = 0;
+    FrameTimer::clock_t::time_point frameStart;
+    FrameTimer::clock_t::time_point lastMark;
+    bool inFrame = false;
+
+    float percentileOf(std::vector<float>& values, float p) {
+        size_t index = std::min(values.size() - 1, static_cast<size_t>(p * (values.size() - 1) + 0.5f));
+        std::nth_element(values.begin(), values.begin() + index, values.end());
+        return values[index];
+    }
+}
+
+void FrameTimer::beginFrame() {
+    frameStart = clock_t::now();
+    lastMark = frameStart;
+    std::fill(std::begin(current), std::end(current), 0.0f);
+    inFrame = true;
+}
+
+void FrameTimer::mark(Phase phase) {
+    if (!inFrame) return;
+    auto now = clock_t::now();
+    current[phase] += std::chrono::duration<float, std::milli>(now - lastMark).count();
+    lastMark = now;
+}
+
+void FrameTimer::endFrame() {
+    if (!inFrame) return;
+    current[PHASE_COUNT] = std::chrono::duration<float, std::milli>(clock_t::now() - frameStart).count();
+    std::copy(std::begin(current), std::end(current), samples[head]);
+    head = (head + 1) % CAPACITY;
+    filled = std::min(filled + 1, CAPACITY);
+    inFrame = false;
+}
+
+size_t FrameTimer::frameCount() {
+    return filled;
+}
+
+std::vector<FrameTimer::PhaseStats> FrameTimer::percentiles() {
+    std::vector<PhaseStats> result;
+    if (filled == 0) return result;
+
+    std::vector<float> column(filled);
+    for (size_t c = 0; c < COLUMNS; c++) {
+        for (size_t i = 0; i < filled; i++) column[i] = samples[i][c];
+        PhaseStats stats{c < PHASE_COUNT ? phaseName(static_cast<Phase>(c)) : "frame"};
+        stats.max = *std::max_element(column.begin(), column.end());
+        stats.p50 = percentileOf(column, 0.50f);
+        stats.p95 = percentileOf(column, 0.95f);
+        stats.p99 = percentileOf(column, 0.99f);
+        result.push_back(stats);
+    }
+    return result;
+}
+
+void FrameTimer::reset() {
+    head = 0;
+    filled = 0;
+    inFrame = false;
+}
+
+// Oldest frame first
+bool FrameTimer::dumpCsv(const std::string& path) {
+    std::ofstream file(path);
+    if (!file.is_open()) {
+        error("Could not write frame timings to: ", path);
+        return false;
+    }
+
+    file << "frame";
+    for (int p = 0; p < PHASE_COUNT; p++) file << "," << phaseName(static_cast<Phase>(p)) << "_ms";
+    file << ",total_ms\n";
+
+    size_t start = (head + CAPACITY - filled) % CAPACITY;
+    for (size_t i = 0; i < filled; i++) {
+        const float* row = samples[(start + i) % CAPACITY];
+        file << i;
+        for (size_t c = 0; c < COLUMNS; c++) file << "," << row[c];
+        file << "\n";
+    }
+    print("Frame timings written to: ", path);
+    return true;
+}
+
+const char* FrameTimer::phaseName(Phase phase) {
+    switch (phase) {
+        case UPDATE: return "update";
+        case POLL: return "poll";
+        case RENDER: return "render";
+        case PRESENT: return "present";
+        case LATE: return "late";
+        case WAIT: return "wait";
+        default: return "?";
+    }
+}
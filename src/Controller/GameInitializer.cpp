@@ -269,7 +269,7 @@ void GameInitializer::Init() {
     });
 
     // Triggered whenever a message is sent in any userinput including chatbox
-    AddEventHandler("UFO::UserInput::NewInput", [this](UUID_t from, std::string message) {
+    AddEventHandler("UFO::UserInput::NewInput", [this](ProcessId_t from, std::string message) {
         if (!userInputBox) {
             return;
         }
@@ -314,6 +314,13 @@ void GameInitializer::Init() {
     Debug();
 }
 
+// Skip the menus and go straight into a run with the selected save, used by --headless
+void GameInitializer::StartHeadless() {
+    ShutdownMainMenu();
+    ShutdownBackgroundMusic();
+    Start();
+}
+
 void GameInitializer::Start(){
     print("Game Start Called");
     gameStartTime = sch->getGameTime();
@@ -324,9 +331,9 @@ void GameInitializer::Start(){
     gM->setScheduler(sch);
     gameManager = gM;
 
-    gM->AddEventHandler("UFO::CHECK::UUID", [this](UUID_t id) {
-        print("Checking UUID: ", id);
-        print(processManager->containsUUID(id));
+    gM->AddEventHandler("UFO::CHECK::UUID", [this](ProcessId_t id) {
+        print("Checking UUID: ", formatProcessId(id));
+        print(processManager->containsId(id));
     });
 
     LoadTextures(); // Load all textures
@@ -457,7 +464,6 @@ void GameInitializer::Debug() {
     debugTexts.push_back(gameTimeText);
 
     AddEventHandler("SDL::OnUpdate", [gameTimeText, fpsText, this](float deltaMs) {
-        print("FPS: ", 1000.0f/deltaMs);
         std::string fpsTextContent = "FPS: " + std::to_string(1000.0f/deltaMs);
         fpsText->setText(fpsTextContent);
         std::string gameTimeContent = "Time: " + std::to_string(sch->getGameTime());
@@ -585,12 +591,16 @@ void GameInitializer::LoadEntitiesFromWorld(sh_ptr<world> w) {
         switch (eType) {
             case entity::PLAYER:
                 break;
-            case entity::ENEMY:
-            case entity::PROJECTILE: {
+            case entity::ENEMY: {
                 auto e = attachGameProcess<entity>(eType, hearts, coords);
                 break;
             }
 
+            case entity::PROJECTILE: {
+                auto e = attachGameProcess<Projectile>(coords, hearts); // GameManager indexes projectiles by class
+                break;
+            }
+
             case entity::ITEM_PICKUP: {
                 if (static_cast<entity::pType>(hearts) == entity::pType::AT) {
                     auto e = attachGameProcess<AT>(coords);
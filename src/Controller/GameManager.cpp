@@ -102,19 +102,22 @@ int GameManager::initialize() {
 
         // Update Before render
         renderWorld(deltaMs);
+        float alpha = sch ? sch->getInterpolationAlpha() : 1.0f;
+        EntityStore::cull(cam->getViewMin(), cam->getViewMax(), alpha);
+        clipLasers(); // again, spinning lasers turned in their update after the step's clip
         for (auto& e : entityList) {
             bool isPlayer = e->isEntityAPlayer();
-            vector2 currentCoords = e->getPosition();
-            bool inView = cam->isPointInView(currentCoords);
+            vector2 currentCoords = e->getRenderPosition(alpha);
+            bool inView = e->isInView();
 
             // Update Player View
             if (isPlayer) {
-                updatePlayerView(inView, e, deltaMs);
+                updatePlayerView(inView, player, deltaMs, currentCoords);
                 continue;
             }
 
             // If entity is done or out of hearts
-            if (e->isDone() || e->getHearts() <= 0) {
+            if (e->isDone() || e->getHearts() <= 0 || e->dead()) {
                 continue;
             }
 
@@ -129,9 +132,7 @@ int GameManager::initialize() {
                 renderEnemy(screenCoords, dim, e);
             }else if (e->isEntityAPickup()) {
                 if (e->getPickupType() == entity::AT) {
-                    if (auto at = std::dynamic_pointer_cast<AT>(e)) {
-                        renderAT(screenCoords, dim, at);
-                    }
+                    renderAT(screenCoords, dim, std::static_pointer_cast<AT>(e));
                 }else if (e->getPickupType() == entity::HEART) {
                     renderHeart(screenCoords, dim, e);
                 }else if (e->getPickupType() == entity::OXY_TANK) {
@@ -140,23 +141,21 @@ int GameManager::initialize() {
                 }else if (e->getPickupType() == entity::KEY_CARD) {
                     renderKeyCard(screenCoords, dim, 1);
                 }else if (e->getPickupType() == entity::ESCAPE_POD) {
-                    TriggerEvent("SDL::Render::SetDrawColor", 255, 215, 0, 255);
-                    TriggerEvent("SDL::Render::DrawRect", screenCoords.x, screenCoords.y, dim.x, dim.y);
-                    TriggerEvent("SDL::Render::ResetDrawColor");
+                    TriggerEvent(SDL::Render::SetDrawColor{255, 215, 0, 255});
+                    TriggerEvent(SDL::Render::DrawRect{screenCoords.x, screenCoords.y, dim.x, dim.y});
+                    TriggerEvent(SDL::Render::ResetDrawColor{});
                 }
             }else if (e->isEntityALaser()) {
-                if (auto l = std::dynamic_pointer_cast<Laser>(e)) {
-                    if (l->isFiring()) {
-                        renderLaser(screenCoords, dim, l);
-                    }
+                const sh_ptr_laser& l = lasers[e->getIndexSlot()];
+                if (l->isFiring()) {
+                    renderLaser(screenCoords, {l->getBeamLength(), dim.y}, l);
                 }
             }else if (e->isEntityAProjectile()) {
-                if (auto p = std::dynamic_pointer_cast<Projectile>(e)) {
-                    if (p->isOutOfRange()) {
-                        continue;
-                    }
-                    renderProjectile(screenCoords, dim, p);
+                const sh_ptr_pew& p = projectiles[e->getIndexSlot()];
+                if (p->isOutOfRange()) {
+                    continue;
                 }
+                renderProjectile(screenCoords, dim, p);
             }
         }
         handleDebugWorldCreator(deltaMs); // handle the debug world creator (used to create walls)
@@ -212,15 +211,25 @@ int GameManager::initialize() {
 }
 
 void GameManager::terminateGame() {
+    if (sch) {sch->cancelTask(gameOverTask);}
     for (auto& e : entityList) {e->abort();};
     for (auto& t : textMap) {if (t.second) {t.second->abort();}};
+    for (auto& t : pickupTextMap) {if (t.second) {t.second->abort();}};
     for (auto& a : asepriteMap) {if (a.second) {a.second->abort();}};
     for (auto& t : txdMap) {if (t.second) {t.second->abort();}};
     for (auto& a : audioMap) {if (a.second) {a.second->abort();}};
     if (cam) {cam->abort();}
     if (world_ptr) {world_ptr->abort();}
     entityList.clear();
+    entityGrid.clear();
+    player.reset();
+    bosses.clear();
+    enemies.clear();
+    lasers.clear();
+    projectiles.clear();
+    for (auto& bucket : pickups) {bucket.clear();}
     textMap.clear();
+    pickupTextMap.clear();
     asepriteMap.clear();
     animMap.clear();
     txdMap.clear();
@@ -234,18 +243,15 @@ void GameManager::terminateGame() {
 
 
 // Update View Functions
-void GameManager::updatePlayerView(bool isVisible, const sh_ptr_e& e, float deltaMs) {
+void GameManager::updatePlayerView(bool isVisible, const sh_ptr_ply& p, float deltaMs, vector2 renderCoords) {
     if (!isVisible) {
         textMap["CamCoords"]->hideText();
         return;
     }
 
-    auto p = std::dynamic_pointer_cast<Player>(e);
-    if (!p) return;
-
-    vector2 currentCoords = e->getPosition();
-    vector2 screenCoords = cam->worldToScreenCoords(currentCoords); // convert world coords to screen coords
-    vector2 dim = e->getDimensions();
+    vector2 currentCoords = p->getPosition();
+    vector2 screenCoords = cam->worldToScreenCoords(renderCoords); // convert world coords to screen coords
+    vector2 dim = p->getDimensions();
 
     if (isDebug()) {
 
@@ -302,9 +308,9 @@ void GameManager::updatePlayerView(bool isVisible, const sh_ptr_e& e, float delt
     }
 
 
-    cam->updateCamera(currentCoords - vector2(SCREEN_WIDTH / 2, SCREEN_HEIGHT / 2));
+    cam->updateCamera(renderCoords - vector2(SCREEN_WIDTH / 2, SCREEN_HEIGHT / 2));
 
-    vector2 playerVel = e->getVelocity();
+    vector2 playerVel = p->getVelocity();
     SDL_Rect currentFrame;
 
     if (!animMap.count("FSS_IDLE") || !animMap.count("FSS_MOVE")) {
@@ -337,34 +343,33 @@ void GameManager::updatePlayerView(bool isVisible, const sh_ptr_e& e, float delt
     asepriteMap["FSS"]->renderFrame(currentFrame, destRect, flip, angle);
     asepriteMap["FSS"]->resetTextureAlpha();
 
-    for (auto & e2 : entityList) {
-        if (!e2->isEntityAPickup()) {
-            continue;
+    for (auto& bucket : pickups) {
+        for (auto& e2 : bucket) {
+            renderPickupInteraction(p, e2, currentCoords);
         }
-        renderPickupInteraction(p, e2, currentCoords);
     }
 
     if (isDebug()) {
         // draw the hit box of the player
-        TriggerEvent("SDL::Render::SetDrawColor", 0, 255, 255, 50);
-        TriggerEvent("SDL::Render::DrawRect",
+        TriggerEvent(SDL::Render::SetDrawColor{0, 255, 255, 50});
+        TriggerEvent(SDL::Render::DrawRect{
                      screenCoords.x - dim.x/2,
                      screenCoords.y - dim.y/2,
                      dim.x,
                      dim.y
-        );
-        TriggerEvent("SDL::Render::ResetDrawColor");
+        });
+        TriggerEvent(SDL::Render::ResetDrawColor{});
 
-        TriggerEvent("SDL::Render::SetDrawColor", 255, 0, 0, 255);
-        TriggerEvent("SDL::Render::DrawPoint", screenCoords.x, screenCoords.y);
-        TriggerEvent("SDL::Render::ResetDrawColor");
+        TriggerEvent(SDL::Render::SetDrawColor{255, 0, 0, 255});
+        TriggerEvent(SDL::Render::DrawPoint{screenCoords.x, screenCoords.y});
+        TriggerEvent(SDL::Render::ResetDrawColor{});
     }
 }
 
 void GameManager::renderEnemy(vector2 screenCoords, vector2 dim, const sh_ptr_e& e) {
     // yes I know I could have just randomized the textures on load of the class but that would have required
     // making a new class for enemies or add more bloat to the entity class so ya no this round about way is OK
-    int ran = mapHashToRange(jenkinsOneAtATimeHash(e->getId()), 1, 3) + 0;
+    int ran = mapHashToRange(static_cast<uint32_t>(e->getId()), 1, 3); // slot index, stable for the enemy's life
     std::string textureName = "ALIEN" + std::to_string(ran) + "::TEXTURE";
 
     auto it = txdMap.find(textureName);
@@ -395,18 +400,18 @@ void GameManager::renderEnemy(vector2 screenCoords, vector2 dim, const sh_ptr_e&
 
     if (isDebug()) {
         // draw the hit box of the player
-        TriggerEvent("SDL::Render::SetDrawColor", 255, 0, 255, 50);
-        TriggerEvent("SDL::Render::DrawRect",
+        TriggerEvent(SDL::Render::SetDrawColor{255, 0, 255, 50});
+        TriggerEvent(SDL::Render::DrawRect{
                      screenCoords.x - dim.x/2,
                      screenCoords.y - dim.y/2,
                      dim.x,
                      dim.y
-        );
-        TriggerEvent("SDL::Render::ResetDrawColor");
+        });
+        TriggerEvent(SDL::Render::ResetDrawColor{});
 
-        TriggerEvent("SDL::Render::SetDrawColor", 255, 0, 0, 255);
-        TriggerEvent("SDL::Render::DrawPoint", screenCoords.x, screenCoords.y);
-        TriggerEvent("SDL::Render::ResetDrawColor");
+        TriggerEvent(SDL::Render::SetDrawColor{255, 0, 0, 255});
+        TriggerEvent(SDL::Render::DrawPoint{screenCoords.x, screenCoords.y});
+        TriggerEvent(SDL::Render::ResetDrawColor{});
     }
 
     int hearts = e->getMaxHearts();
@@ -433,7 +438,7 @@ void GameManager::renderEnemy(vector2 screenCoords, vector2 dim, const sh_ptr_e&
 }
 
 void GameManager::renderLaser(vector2 screenCoords, vector2 dim, const sh_ptr_laser& l) {
-    Heading h = l->getHeading(); // Number from 0 to 360
+    Heading h = l->getBeamHeading(); // Number from 0 to 360, the heading the beam was clipped at
     vector2 laserStart = {screenCoords.x, screenCoords.y};
     int length = dim.x;
     int width = dim.y;
@@ -496,9 +501,9 @@ void GameManager::renderProjectile(vector2 screenCoords, vector2 dim, const sh_p
             renderAT(drawCoords, dim2);
         }
         if (isDebug()) {
-            TriggerEvent("SDL::Render::SetDrawColor", 155, 40, 10, 100);
-            TriggerEvent("SDL::Render::DrawRect", screenCoords.x, screenCoords.y, dim.x, dim.y);
-            TriggerEvent("SDL::Render::ResetDrawColor");
+            TriggerEvent(SDL::Render::SetDrawColor{155, 40, 10, 100});
+            TriggerEvent(SDL::Render::DrawRect{screenCoords.x, screenCoords.y, dim.x, dim.y});
+            TriggerEvent(SDL::Render::ResetDrawColor{});
         }
     }else {
         auto it = txdMap.find("LASER::TEXTURE");
@@ -515,9 +520,9 @@ void GameManager::renderProjectile(vector2 screenCoords, vector2 dim, const sh_p
         txdMap["LASER::TEXTURE"]->render(srcRect, destRect, 0, SDL_FLIP_NONE);
 
         if (isDebug()) {
-            TriggerEvent("SDL::Render::SetDrawColor", 155, 40, 10, 100);
-            TriggerEvent("SDL::Render::DrawRect", screenCoords.x, screenCoords.y, dim.x, dim.y);
-            TriggerEvent("SDL::Render::ResetDrawColor");
+            TriggerEvent(SDL::Render::SetDrawColor{155, 40, 10, 100});
+            TriggerEvent(SDL::Render::DrawRect{screenCoords.x, screenCoords.y, dim.x, dim.y});
+            TriggerEvent(SDL::Render::ResetDrawColor{});
         }
     }
 }
@@ -541,16 +546,16 @@ void GameManager::renderAT(vector2 screenCoords, vector2 dim, const sh_ptr_at& a
     };
 
     if (isDebug()) { // draw a rec around the texture (background)
-        TriggerEvent("SDL::Render::SetDrawColor", 0, 255, 255, 255);
-        TriggerEvent("SDL::Render::DrawRect", screenCoords.x - (dim.x / 2), screenCoords.y - (dim.y / 2), dim.x, dim.y);
-        TriggerEvent("SDL::Render::ResetDrawColor");
+        TriggerEvent(SDL::Render::SetDrawColor{0, 255, 255, 255});
+        TriggerEvent(SDL::Render::DrawRect{screenCoords.x - (dim.x / 2), screenCoords.y - (dim.y / 2), dim.x, dim.y});
+        TriggerEvent(SDL::Render::ResetDrawColor{});
 
     }
     txdMap["AT::TEXTURE"]->render(srcRect, destRect, 0, SDL_FLIP_NONE);
     if (isDebug()) { // draw a center point of the AT
-        TriggerEvent("SDL::Render::SetDrawColor", 255, 0, 0, 255);
-        TriggerEvent("SDL::Render::DrawPoint", screenCoords.x, screenCoords.y);
-        TriggerEvent("SDL::Render::ResetDrawColor");
+        TriggerEvent(SDL::Render::SetDrawColor{255, 0, 0, 255});
+        TriggerEvent(SDL::Render::DrawPoint{screenCoords.x, screenCoords.y});
+        TriggerEvent(SDL::Render::ResetDrawColor{});
 
     }
 }
@@ -594,9 +599,9 @@ void GameManager::renderHeart(vector2 screenCoords, vector2 dim, const sh_ptr_e&
     };
 
     if (isDebug()) {
-        TriggerEvent("SDL::Render::SetDrawColor", 255, 0, 0, 255);
-        TriggerEvent("SDL::Render::DrawRect", screenCoords.x - (dim.x/2), screenCoords.y - (dim.y/2), dim.x, dim.y);
-        TriggerEvent("SDL::Render::ResetDrawColor");
+        TriggerEvent(SDL::Render::SetDrawColor{255, 0, 0, 255});
+        TriggerEvent(SDL::Render::DrawRect{screenCoords.x - (dim.x/2), screenCoords.y - (dim.y/2), dim.x, dim.y});
+        TriggerEvent(SDL::Render::ResetDrawColor{});
     }
 
     txdMap["HEART::TEXTURE"]->render(srcRect, destRect, 0, SDL_FLIP_NONE);
@@ -649,9 +654,9 @@ void GameManager::renderOxyTank(vector2 screenCoords, vector2 dim) {
     };
 
     if (isDebug()) {
-        TriggerEvent("SDL::Render::SetDrawColor", 0, 255, 0, 255);
-        TriggerEvent("SDL::Render::DrawRect", screenCoords.x, screenCoords.y, dim.x, dim.y);
-        TriggerEvent("SDL::Render::ResetDrawColor");
+        TriggerEvent(SDL::Render::SetDrawColor{0, 255, 0, 255});
+        TriggerEvent(SDL::Render::DrawRect{screenCoords.x, screenCoords.y, dim.x, dim.y});
+        TriggerEvent(SDL::Render::ResetDrawColor{});
     }
 
     txdMap["OXY_TANK::TEXTURE"]->render(srcRect, destRect, 0, SDL_FLIP_NONE);
@@ -675,9 +680,9 @@ void GameManager::renderKeyCard(vector2 screenCoords, vector2 dim, int keyCardTy
     };
 
     if (isDebug()) {
-        TriggerEvent("SDL::Render::SetDrawColor", 0, 255, 255, 255);
-        TriggerEvent("SDL::Render::DrawRect", screenCoords.x, screenCoords.y, dim.x, dim.y);
-        TriggerEvent("SDL::Render::ResetDrawColor");
+        TriggerEvent(SDL::Render::SetDrawColor{0, 255, 255, 255});
+        TriggerEvent(SDL::Render::DrawRect{screenCoords.x, screenCoords.y, dim.x, dim.y});
+        TriggerEvent(SDL::Render::ResetDrawColor{});
     }
 
     txdMap[textureName]->render(srcRect, destRect, 0, SDL_FLIP_NONE);
@@ -919,7 +924,7 @@ void GameManager::drawWall(wall* cur_wall) {
                     print("Wall 2: ", thisPoint, wid, len, cur_wid, cur_len);
                     print("Wall 3: ", screenCoords, destRect.x, destRect.y, destRect.w, destRect.h);
                 }else {
-                    TriggerEvent("SDL::Render::DrawRect", screenCoords.x + 5, screenCoords.y, 1, 1);
+                    TriggerEvent(SDL::Render::DrawRect{screenCoords.x + 5, screenCoords.y, 1, 1});
                 }
 
 //                txdMap["WALL::TEXTURE"]->render(srcRect, destRect, h, SDL_FLIP_NONE);
@@ -1019,23 +1024,15 @@ void GameManager::clearPickupInteraction(const sh_ptr_e& e) {
         return;
     }
 
-    std::string textMapName;
-
-    if (pickupType == entity::KEY_CARD) {
-        textMapName = "KEYCARD::" + e->getId();
-    }else if (pickupType == entity::ESCAPE_POD) {
-        textMapName = "ESCAPE::" + e->getId();
-    }
-
-    auto it = textMap.find(textMapName);
-    if (it != textMap.end()) {
+    auto it = pickupTextMap.find(e->getId());
+    if (it != pickupTextMap.end()) {
         it->second->hideText();
-        textMap.erase(it);
+        pickupTextMap.erase(it);
     }
 }
 
 void GameManager::renderPickupInteraction(const sh_ptr_ply& ply, const sh_ptr_e& e, vector2& currentCoords) {
-    if (!e || !ply) {
+    if (!e || !ply || e->dead()) { // picked up, still in its bucket until the next update walk
         return;
     }
 
@@ -1048,18 +1045,10 @@ void GameManager::renderPickupInteraction(const sh_ptr_ply& ply, const sh_ptr_e&
     vector2 enemyCoords = e->getPosition();
     bool isInside = ply->isPointInEntity(enemyCoords);
 
-    std::string textMapName;
-
-    if (pickupType == entity::KEY_CARD) {
-        textMapName = "KEYCARD::" + e->getId();
-    }else if (pickupType == entity::ESCAPE_POD) {
-        textMapName = "ESCAPE::" + e->getId();
-    }
-
     bool inView = cam->isPointInView(enemyCoords);
     bool isClose = ((enemyCoords - currentCoords).length() < 150);
 
-    sh_ptr<text> mapped = textMap[textMapName];
+    sh_ptr<text>& mapped = pickupTextMap[e->getId()];
 
     if (!inView) {
         if (mapped) {mapped->hideText();}
@@ -1067,9 +1056,8 @@ void GameManager::renderPickupInteraction(const sh_ptr_ply& ply, const sh_ptr_e&
     }
 
     if (!mapped) {
-        textMap[textMapName] = std::make_shared<text>(passFunc, "[E]", 25);
-        pM->attachProcess(textMap[textMapName]);
-        mapped = textMap[textMapName];
+        mapped = std::make_shared<text>(passFunc, "[E]", 25);
+        pM->attachProcess(mapped);
     }
 
     if (!isClose) {
@@ -1101,131 +1089,139 @@ void GameManager::renderPickupInteraction(const sh_ptr_ply& ply, const sh_ptr_e&
 
 
 // Update Controller Functions
-void GameManager::update(float deltaMs) {
-    if (!gameRunning) {
-        int baseFontSize = (int) getScaledCoords({25, 25}).length(); // base is 50
-        auto gameOverText = textMap["GameOver"];
-        if (!gameOverText) {
-            gameOverText = std::make_shared<text>(passFunc, "YOU DIED", baseFontSize);
-            pM->attachProcess(gameOverText);
-            gameOverText->setTextRelativePosition(0.001, 0.001);
-            gameOverText->setCurrentPositionBasedOnRelativePosition();
-            gameOverText->setTextColor({255, 0, 0, 200});
-            textMap["GameOver"] = gameOverText;
-        }
-
-        if (gameOverText->state() != text::RUNNING) {
-            return;
-        }
-
-
-
-        int curFontSize = gameOverText->getFontSize();
-        float curTime = sch->getGameTime();
-        int elapsedTime = curTime - gameOverTimeStamp;
+// "YOU DIED" grows over 6 seconds, then the game ends
+Task GameManager::gameOverSequence() {
+    int baseFontSize = (int) getScaledCoords({25, 25}).length(); // base is 50
+    auto gameOverText = std::make_shared<text>(passFunc, "YOU DIED", baseFontSize);
+    pM->attachProcess(gameOverText);
+    gameOverText->setTextRelativePosition(0.001, 0.001);
+    gameOverText->setCurrentPositionBasedOnRelativePosition();
+    gameOverText->setTextColor({255, 0, 0, 200});
+    textMap["GameOver"] = gameOverText;
+
+    while (gameOverText->state() != text::RUNNING) {
+        co_await nextFrame();
+    }
 
-        int toFontSize = map_range(elapsedTime, 0, 6000, baseFontSize, baseFontSize*3);
+    float elapsedTime = 0;
+    int toFontSize = baseFontSize;
+    while (toFontSize < baseFontSize*3) {
+        elapsedTime += co_await nextFrame();
+        toFontSize = map_range((int) elapsedTime, 0, 6000, baseFontSize, baseFontSize*3);
         gameOverText->setFontSize(toFontSize);
-        if (toFontSize >= baseFontSize*3) {
-            TriggerEvent("UFO::EndGame");
-            TriggerEvent("UFO::Chat::AddMessage", "Game Over!");
-        }
+    }
 
+    QueueEvent(EventQueue::LATE, "UFO::EndGame");
+    QueueEvent(EventQueue::LATE, "UFO::Chat::AddMessage", "Game Over!");
+}
 
-        return;
+void GameManager::update(float deltaMs) {
+    if (!gameRunning) {
+        return; // gameOverSequence takes it from here
     }
 
-    std::list<sh_ptr_e> removalList;
-    for (auto& e : entityList) {
+    clipLasers();
+
+    // Nothing below fires events that can reach back into entityList (game end is queued), so dead entities are
+    // erased in place instead of being collected first
+    for (auto it = entityList.begin(); it != entityList.end();) {
+        sh_ptr_e e = *it;
         if (e->isDone() || e->getHearts() <= 0 || e->dead()) {
             if (!e->dead()) {
                 e->fail();
             }
 
-            removalList.push_back(e);
-
             if (e->isEntityAPlayer()) {
                 if (!gameRunning) {return;}
-                gameOverTimeStamp = sch->getGameTime();
                 gameRunning = false;
+                gameOverTask = sch->startTask(gameOverSequence());
                 return;
             }
 
+            detachEntity(e);
+            it = entityList.erase(it);
             continue;
         }
 
         // Remove projectiles that are too far away from the shooting position and not in view
         if (e->isEntityAProjectile() && e->inWorld()) {
-            auto p = std::dynamic_pointer_cast<Projectile>(e);
-            if (!p) continue;
+            sh_ptr_pew p = projectiles[e->getIndexSlot()]; // a copy, the bucket reorders when p2 is detached
 
             if (p->isOutOfRange()) {
                 e->abort();
-                removalList.push_back(e);
+                detachEntity(e);
+                it = entityList.erase(it);
                 continue;
-            }else {
-                // Check if two projectiles hit each other
-                for (auto& e2 : entityList) {
-                    if (e2->isEntityAProjectile() && e2 != e) {
-                        auto p2 = std::dynamic_pointer_cast<Projectile>(e2);
-                        if (!p2) continue;
-
-                        if (p->isEntityInEntity(e2) && (e->getPosition() - e2->getPosition()).length() < 20) {
-                            if (p->getOwner() != p2->getOwner()) {
-                                p->abort();
-                                p2->abort();
-                                removalList.push_back(e);
-                                removalList.push_back(e2);
-                                continue;
-                            }
+            }
+
+            // Check if two projectiles hit each other, only the ones overlapping this one can
+            bool hitProjectile = false;
+            vector2 min, max;
+            entityBounds(e, min, max);
+            nearby.clear();
+            entityGrid.queryAABB(min, max, nearby);
+            for (uint32_t id : nearby) {
+                sh_ptr_e e2 = entityGrid.get(id);
+                if (e2->isEntityAProjectile() && e2 != e) {
+                    const sh_ptr_pew& p2 = projectiles[e2->getIndexSlot()];
+
+                    if (p->isEntityInEntity(e2) && (e->getPosition() - e2->getPosition()).length() < 20) {
+                        if (p->getOwner() != p2->getOwner()) {
+                            p->abort();
+                            p2->abort();
+                            detachEntity(e2); // dead now, erased when the walk reaches it
+                            hitProjectile = true;
+                            break;
                         }
                     }
                 }
             }
+            if (hitProjectile) {
+                detachEntity(e);
+                it = entityList.erase(it);
+                continue;
+            }
         }
 
         // Handle Collisions
         if (e->isEntityAnEnemy()) {
             handleEnemyUpdate(e, deltaMs);
         }else if (e->isEntityAnEnemyBoss()) {
-            handleBossUpdate(e, deltaMs);
+            handleBossUpdate(bosses[e->getIndexSlot()], deltaMs);
         }else if (e->isEntityAPlayer()) {
-            handlePlayerUpdate(e, deltaMs);
+            handlePlayerUpdate(player, deltaMs);
         }
+        ++it;
+    }
+
+    // Every entity moves in one sweep over the store, then gets pushed back out of walls
+    EntityStore::integrate(deltaMs);
+    for (auto& e : entityList) {
+        if (e->dead()) continue; // hit by another projectile this step, out of the grid already
 
-        // Handle Update of Coords
-        e->updateCoordsFromVelocity(deltaMs);
         // Check if the new coords are out of bounds or hitting a wall
-        vectorList_t entityCorners;
-        entityCorners.push_back(e->getPosition() + (-e->getLength()/2, -e->getWidth()/2));
-        entityCorners.push_back(e->getPosition() + (-e->getLength()/2, e->getWidth()/2));
-        entityCorners.push_back(e->getPosition() + (e->getLength()/2, e->getWidth()/2));
-        entityCorners.push_back(e->getPosition() + (e->getLength()/2, -e->getWidth()/2));
-        if (world_ptr->isRectInWall(entityCorners)) {
+        if (e->isEntityAProjectile()) {
+            sweepProjectile(e);
+        } else if (world_ptr->isRectInWall(e->getBounds())) {
             e->setPosition(e->getLastCoords());
-            if (e->isEntityAProjectile()) {
-                e->removeHearts(e->getHearts());
-                if (e->getHearts() == 0) {
-                    e->fail();
-                }
-            }
         }
+        gridUpdate(e);
     }
-
-
-    for (const auto& e : removalList) {
-        entityList.remove(e);
-    }
-    removalList.clear();
 }
 
-void GameManager::handlePlayerUpdate(const sh_ptr_e& e, float deltaMs) {
-    // Cast to player and if does not work return
-    auto p = std::dynamic_pointer_cast<Player>(e);
-    if (!p) return;
-
+void GameManager::handlePlayerUpdate(const sh_ptr_ply& p, float deltaMs) {
+    sh_ptr_e e = p;
     vector2 currentCoords = e->getPosition();
-    for (auto& e2 : entityList) {
+
+    // Pickups, lasers and projectiles have to overlap the player, enemies hit within 20 units of its center
+    vector2 min, max;
+    entityBounds(e, min, max);
+    min = {std::min(min.x, currentCoords.x - 20), std::min(min.y, currentCoords.y - 20)};
+    max = {std::max(max.x, currentCoords.x + 20), std::max(max.y, currentCoords.y + 20)};
+    nearby.clear();
+    entityGrid.queryAABB(min, max, nearby);
+    for (uint32_t id : nearby) {
+        sh_ptr_e e2 = entityGrid.get(id); // a copy, attachEntity below can grow the grid
         if (e2->isEntityAPickup()) {
             vector2 enemyCoords = e2->getPosition();
             int pickupType = e2->getPickupType();
@@ -1264,7 +1260,7 @@ void GameManager::handlePlayerUpdate(const sh_ptr_e& e, float deltaMs) {
                         e2->setHearts(0);
                         clearPickupInteraction(e2);
                         e2->succeed();
-                        TriggerEvent("UFO::EndGame");
+                        QueueEvent(EventQueue::LATE, "UFO::EndGame"); // ends the game after this frame, not mid entityList walk
                     }
                 }
             }
@@ -1302,23 +1298,22 @@ void GameManager::handlePlayerUpdate(const sh_ptr_e& e, float deltaMs) {
                 }
             }
         }else if (e2->isEntityALaser()) {
-            auto l = std::dynamic_pointer_cast<Laser>(e2);
-            if (!l) return;
+            const sh_ptr_laser& l = lasers[e2->getIndexSlot()];
             if (l->isFiring()) {
                 // Get the laser start and end points
                 vector2 p1 = l->getPosition();
-                vector2 direction = angleToVector2(l->getHeading());  // Normalized direction vector
-                vector2 p2 = p1 + direction * l->getLength();  // Laser extends in this direction
+                vector2 direction = angleToVector2(l->getBeamHeading());  // Normalized direction vector, as clipped
+                vector2 p2 = p1 + direction * l->getBeamLength();  // Laser extends in this direction, up to a wall
                 // Calculate perpendicular vector to get the width of the laser
                 vector2 perp(-direction.y, direction.x);  // Rotates 90 degrees to get width
                 perp = perp * (l->getWidth() / 2.0f);  // Scale perpendicular by half width
-                std::vector<vector2> laserBox = {
+                Quad laserBox = {{
                         p1 - perp,  // Bottom-left
                         p1 + perp,  // Bottom-right
                         p2 + perp,  // Top-right
                         p2 - perp   // Top-left
-                };
-                if (isPointInBounds(currentCoords, laserBox)) {
+                }};
+                if (laserBox.contains(currentCoords)) {
                     playerTakeHit(p, l->getDamage());
                     if (!p->isEntityInvincible()) {
                         if (l->isSpinning()) {
@@ -1334,8 +1329,8 @@ void GameManager::handlePlayerUpdate(const sh_ptr_e& e, float deltaMs) {
             vector2 projCoords = e2->getPosition();
             if (e2->isEntityInEntity(p)) {
                 if (e2->getHearts() > 0) {
-                    auto proj = std::dynamic_pointer_cast<Projectile>(e2);
-                    if (!proj || !proj->getOwner()) continue;
+                    const sh_ptr_pew& proj = projectiles[e2->getIndexSlot()];
+                    if (!proj->getOwner()) continue;
                     if (proj->getOwner() == e) {
                         // if the projectile is from the player ignore it
                         continue;
@@ -1408,28 +1403,29 @@ void GameManager::handleEnemyUpdate(const sh_ptr_e& e, float deltaMs) {
     bool inKnockback = e->isKnockedBack();
     vector2 ENEMY_SPEED = getScaledCoords({0.19f/2, 0.19f/2});
 
+    if (player && !player->isInvisible()) { // cant see invisible players so no follow
+        vector2 playerCoords = player->getPosition();
+        // distance first, the ray only runs for enemies close enough to care
+        if ((currentCoords - playerCoords).length() < (SCREEN_WIDTH / 4) &&
+            world_ptr->hasLineOfSight(currentCoords, playerCoords)) {
+            newVel = (playerCoords - currentCoords).normalize() * ENEMY_SPEED.len();
+            isClose = true;
+        }
+    }
 
-
-    for (auto& e2 : entityList) {
-        if (e2->isEntityAPlayer()) {
-            auto p = std::dynamic_pointer_cast<Player>(e2);
-            if (!p) continue;
-            if (p->isInvisible()) { // cant see invisible players so no follow
-                continue;
-            }
-            vector2 playerCoords = e2->getPosition();
-            if ((currentCoords - playerCoords).length() < (SCREEN_WIDTH / 4)) {
-                newVel = (playerCoords - currentCoords).normalize() * ENEMY_SPEED.len();
-                isClose = true;
-            }
-            continue;
-        }else if (e2->isEntityAProjectile()) {
+    // Only projectiles overlapping the enemy can hit it
+    vector2 min, max;
+    entityBounds(e, min, max);
+    nearby.clear();
+    entityGrid.queryAABB(min, max, nearby);
+    for (uint32_t id : nearby) {
+        sh_ptr_e e2 = entityGrid.get(id);
+        if (e2->isEntityAProjectile()) {
             vector2 projCoords = e2->getPosition();
             if (e2->isEntityInEntity(e)) {
                 if (e2->getHearts() > 0) {
-                    auto proj = std::dynamic_pointer_cast<Projectile>(e2);
-                    if (!proj) continue;
-                    if (proj->getOwner() != getPlayer()) {
+                    const sh_ptr_pew& proj = projectiles[e2->getIndexSlot()];
+                    if (proj->getOwner() != player) {
                         // if the projectile is NOT from the player ignore it
                         continue;
                     }
@@ -1488,140 +1484,140 @@ void GameManager::handleEnemyUpdate(const sh_ptr_e& e, float deltaMs) {
     e->setVelocity(newVel);
 }
 
-void GameManager::handleBossUpdate(const sh_ptr_e& e, float deltaMs) {
+void GameManager::handleBossUpdate(const sh_ptr<Boss>& b, float deltaMs) {
+    sh_ptr_e e = b;
     vector2 currentCoords = e->getPosition();
     vector2 curVel = e->getVelocity();
     vector2 newVel = vector2(0.0f, 0.0f);
 
-    auto b = std::dynamic_pointer_cast<Boss>(e);
-    if (!b) return;
-
-    for (auto& e2 : entityList) {
-        if (e2->isEntityAPlayer()) {
-            // If the player is nearby (later will add check if in boss room)
-            // create minions and projectiles
-            auto p = std::dynamic_pointer_cast<Player>(e2);
-            if (!p) return;
-            if (p->isInvisible()) { // cant see invisible players so no react
-                continue;
+    // If the player is nearby (later will add check if in boss room)
+    // create minions and projectiles
+    sh_ptr_ply p = player;
+    if (p && !p->isInvisible()) { // cant see invisible players so no react
+        vector2 playerCoords = p->getPosition();
+        if ((currentCoords - playerCoords).length() < ((float) SCREEN_WIDTH)) {
+            if (b->canSpawnMinion()) {
+                Heading h = getHeadingFromVectors(currentCoords, playerCoords);
+                vector2 spawnCoords = currentCoords + (angleToVector2(h) * (p->getDimensions().x * 2.0f));
+                sh_ptr_e minion = b->spawnMinion(spawnCoords);
+                pM->attachProcess(minion);
+                attachEntity(minion);
+                minion->spawn();
+                minion->AddEventHandler("ENTITY::SUCCEED", [b, minion, this]() {
+                    b->removeMinion(minion);
+                });
+
+                minion->AddEventHandler("ENTITY::ABORT", [b, minion, this]() {
+                    b->removeMinion(minion);
+                });
             }
-            vector2 playerCoords = e2->getPosition();
-            if ((currentCoords - playerCoords).length() < ((float) SCREEN_WIDTH)) {
-                if (b->canSpawnMinion()) {
-                    Heading h = getHeadingFromVectors(currentCoords, playerCoords);
-                    vector2 spawnCoords = currentCoords + (angleToVector2(h) * (p->getDimensions().x * 2.0f));
-                    sh_ptr_e minion = b->spawnMinion(spawnCoords);
-                    pM->attachProcess(minion);
-                    attachEntity(minion);
-                    minion->spawn();
-                    minion->AddEventHandler("ENTITY::SUCCEED", [b, minion, this]() {
-                        b->removeMinion(minion);
+
+            if (b->canSpawnProjectile()) {
+                Heading h = getHeadingFromVectors(currentCoords, playerCoords);
+                vector2 pVel = angleToVector2(h) * getScaledCoords({0.70, 0.70}).length();
+                vector2 spawnCoords = currentCoords + (angleToVector2(h) * 10.0f );
+                sh_ptr_e proj = b->spawnProjectile(spawnCoords);
+                pM->attachProcess(proj);
+                attachEntity(proj);
+                proj->spawn();
+                proj->setVelocity(pVel);
+
+                proj->AddEventHandler("ENTITY::SUCCEED", [b, proj, this]() {
+                    b->removeProjectile(proj);
+                });
+
+                proj->AddEventHandler("ENTITY::ABORT", [b, proj, this]() {
+                    b->removeProjectile(proj);
+                });
+                if(b->inRageMode()) {
+                    //Spawn 4 slower projectiles, one in each cardinal direction, (nsew)
+                    vector2 pVeln = angleToVector2(h) * getScaledCoords({0.30, 0.30}).length();
+
+                    sh_ptr_e projn = b->spawnProjectile(spawnCoords);
+                    pM->attachProcess(projn);
+                    attachEntity(projn);
+                    projn->spawn();
+                    projn->setVelocity(pVeln);
+
+                    projn->AddEventHandler("ENTITY::SUCCEED", [b, projn, this]() {
+                        b->removeProjectile(projn);
                     });
 
-                    minion->AddEventHandler("ENTITY::ABORT", [b, minion, this]() {
-                        b->removeMinion(minion);
+                    projn->AddEventHandler("ENTITY::ABORT", [b, projn, this]() {
+                        b->removeProjectile(projn);
                     });
-                }
+                    
+                    vector2 pVels = -angleToVector2(h) * getScaledCoords({0.30, 0.30}).length();
+
+                    sh_ptr_e projs = b->spawnProjectile(spawnCoords);
+                    pM->attachProcess(projs);
+                    attachEntity(projs);
+                    projs->spawn();
+                    projs->setVelocity(pVels);
 
-                if (b->canSpawnProjectile()) {
-                    Heading h = getHeadingFromVectors(currentCoords, playerCoords);
-                    vector2 pVel = angleToVector2(h) * getScaledCoords({0.70, 0.70}).length();
-                    vector2 spawnCoords = currentCoords + (angleToVector2(h) * 10.0f );
-                    sh_ptr_e proj = b->spawnProjectile(spawnCoords);
-                    pM->attachProcess(proj);
-                    attachEntity(proj);
-                    proj->spawn();
-                    proj->setVelocity(pVel);
-
-                    proj->AddEventHandler("ENTITY::SUCCEED", [b, proj, this]() {
-                        b->removeProjectile(proj);
+                    projs->AddEventHandler("ENTITY::SUCCEED", [b, projs, this]() {
+                        b->removeProjectile(projs);
                     });
 
-                    proj->AddEventHandler("ENTITY::ABORT", [b, proj, this]() {
-                        b->removeProjectile(proj);
+                    projs->AddEventHandler("ENTITY::ABORT", [b, projs, this]() {
+                        b->removeProjectile(projs);
+                    });
+                    
+                    vector2 pVele = angleToVector2(h) * getScaledCoords({0.30, 0.30}).length();
+                    double projey = pVele.getY();
+                    pVele.y = pVele.getX();
+                    pVele.x = -projey;
+
+                    sh_ptr_e proje = b->spawnProjectile(spawnCoords);
+                    pM->attachProcess(proje);
+                    attachEntity(proje);
+                    proje->spawn();
+                    proje->setVelocity(pVele);
+
+                    proje->AddEventHandler("ENTITY::SUCCEED", [b, proje, this]() {
+                        b->removeProjectile(proje);
+                    });
+
+                    proje->AddEventHandler("ENTITY::ABORT", [b, proje, this]() {
+                        b->removeProjectile(proje);
+                    });
+                    
+                    vector2 pVelw = angleToVector2(h) * getScaledCoords({0.30, 0.30}).length();
+                    double projwx = pVelw.getX();
+                    pVelw.x = pVelw.getY();
+                    pVelw.y = -projwx;
+
+                    sh_ptr_e projw = b->spawnProjectile(spawnCoords);
+                    pM->attachProcess(projw);
+                    attachEntity(projw);
+                    projw->spawn();
+                    projw->setVelocity(pVelw);
+
+                    projw->AddEventHandler("ENTITY::SUCCEED", [b, projw, this]() {
+                        b->removeProjectile(projw);
+                    });
+
+                    projw->AddEventHandler("ENTITY::ABORT", [b, projw, this]() {
+                        b->removeProjectile(projw);
                     });
-                    if(b->inRageMode()) {
-                        //Spawn 4 slower projectiles, one in each cardinal direction, (nsew)
-                        vector2 pVeln = angleToVector2(h) * getScaledCoords({0.30, 0.30}).length();
-
-                        sh_ptr_e projn = b->spawnProjectile(spawnCoords);
-                        pM->attachProcess(projn);
-                        attachEntity(projn);
-                        projn->spawn();
-                        projn->setVelocity(pVeln);
-
-                        projn->AddEventHandler("ENTITY::SUCCEED", [b, projn, this]() {
-                            b->removeProjectile(projn);
-                        });
-
-                        projn->AddEventHandler("ENTITY::ABORT", [b, projn, this]() {
-                            b->removeProjectile(projn);
-                        });
-                        
-                        vector2 pVels = -angleToVector2(h) * getScaledCoords({0.30, 0.30}).length();
-
-                        sh_ptr_e projs = b->spawnProjectile(spawnCoords);
-                        pM->attachProcess(projs);
-                        attachEntity(projs);
-                        projs->spawn();
-                        projs->setVelocity(pVels);
-
-                        projs->AddEventHandler("ENTITY::SUCCEED", [b, projs, this]() {
-                            b->removeProjectile(projs);
-                        });
-
-                        projs->AddEventHandler("ENTITY::ABORT", [b, projs, this]() {
-                            b->removeProjectile(projs);
-                        });
-                        
-                        vector2 pVele = angleToVector2(h) * getScaledCoords({0.30, 0.30}).length();
-                        double projey = pVele.getY();
-                        pVele.y = pVele.getX();
-                        pVele.x = -projey;
-
-                        sh_ptr_e proje = b->spawnProjectile(spawnCoords);
-                        pM->attachProcess(proje);
-                        attachEntity(proje);
-                        proje->spawn();
-                        proje->setVelocity(pVele);
-
-                        proje->AddEventHandler("ENTITY::SUCCEED", [b, proje, this]() {
-                            b->removeProjectile(proje);
-                        });
-
-                        proje->AddEventHandler("ENTITY::ABORT", [b, proje, this]() {
-                            b->removeProjectile(proje);
-                        });
-                        
-                        vector2 pVelw = angleToVector2(h) * getScaledCoords({0.30, 0.30}).length();
-                        double projwx = pVelw.getX();
-                        pVelw.x = pVelw.getY();
-                        pVelw.y = -projwx;
-
-                        sh_ptr_e projw = b->spawnProjectile(spawnCoords);
-                        pM->attachProcess(projw);
-                        attachEntity(projw);
-                        projw->spawn();
-                        projw->setVelocity(pVelw);
-
-                        projw->AddEventHandler("ENTITY::SUCCEED", [b, projw, this]() {
-                            b->removeProjectile(projw);
-                        });
-
-                        projw->AddEventHandler("ENTITY::ABORT", [b, projw, this]() {
-                            b->removeProjectile(projw);
-                        });
-                    }
                 }
             }
-            continue;
-        }else if (e2->isEntityAProjectile()) {
+        }
+    }
+
+    // Only projectiles overlapping the boss can hit it
+    vector2 min, max;
+    entityBounds(e, min, max);
+    nearby.clear();
+    entityGrid.queryAABB(min, max, nearby);
+    for (uint32_t id : nearby) {
+        sh_ptr_e e2 = entityGrid.get(id);
+        if (e2->isEntityAProjectile()) {
             vector2 projCoords = e2->getPosition();
             if (e2->isEntityInEntity(e)) {
                 if (e2->getHearts() > 0) {
-                    auto proj = std::dynamic_pointer_cast<Projectile>(e2);
-                    if (!proj) continue;
-                    if (proj->getOwner() != getPlayer()) {
+                    const sh_ptr_pew& proj = projectiles[e2->getIndexSlot()];
+                    if (proj->getOwner() != player) {
                         // if the projectile is NOT from the player ignore it
                         continue;
                     }
@@ -1640,6 +1636,82 @@ void GameManager::handleBossUpdate(const sh_ptr_e& e, float deltaMs) {
     e->setVelocity({0.0,0.0});
 }
 
+// Beams stop at the first wall in their way. All firing lasers go through one segment query. Runs at the start of
+// the step for the hit tests and again before drawing; each laser keeps the heading it was clipped at
+void GameManager::clipLasers() {
+    beamStart.clear();
+    beamEnd.clear();
+    beamHeadings.clear();
+    for (const sh_ptr_laser& l : lasers) {
+        if (!l->isFiring()) continue;
+        Heading h = l->getHeading();
+        vector2 start = l->getPosition();
+        beamHeadings.push_back(h);
+        beamStart.push_back(start);
+        beamEnd.push_back(start + angleToVector2(h) * static_cast<float>(l->getLength()));
+    }
+    world_ptr->segmentsToWalls(beamStart, beamEnd, beamClip);
+
+    size_t i = 0;
+    for (const sh_ptr_laser& l : lasers) {
+        if (!l->isFiring()) continue;
+        l->setBeam(beamHeadings[i], static_cast<float>(l->getLength()) * beamClip[i]);
+        i++;
+    }
+}
+
+// A projectile can cover more than a wall's width in one step, so instead of testing where it ended up it is swept
+// from its last position. It stops at the first wall (and dies there) or at the first entity it can damage, where
+// that entity's handler sees the overlap on the next step.
+void GameManager::sweepProjectile(const sh_ptr_e& e) {
+    vector2 last = e->getLastCoords();
+    vector2 delta = e->getPosition() - last;
+    AABB start = AABB::fromCenter(last, vector2(e->getLength() / 2.0f, e->getWidth() / 2.0f));
+
+    float toi = 1.0f;
+    bool hitWall = world_ptr->sweepRectInWall(start, delta, toi);
+    vector2 stop = last + delta * toi;
+
+    // Entities as circles inside their boxes, so touching circles always means overlapping boxes. Targets are
+    // slow next to a projectile, the grid entry from their last step is close enough for the broad phase
+    bool hitTarget = false;
+    sh_ptr_e owner = projectiles[e->getIndexSlot()]->getOwner();
+    if (owner) {
+        bool fromPlayer = owner == player;
+        float radius = static_cast<float>(std::min(e->getLength(), e->getWidth())) / 2.0f;
+        vector2 min = {std::min(start.min.x, start.min.x + delta.x), std::min(start.min.y, start.min.y + delta.y)};
+        vector2 max = {std::max(start.max.x, start.max.x + delta.x), std::max(start.max.y, start.max.y + delta.y)};
+        nearby.clear();
+        entityGrid.queryAABB(min, max, nearby);
+        for (uint32_t id : nearby) {
+            const sh_ptr_e& e2 = entityGrid.get(id);
+            bool target = fromPlayer ? (e2->isEntityAnEnemy() || e2->isEntityAnEnemyBoss()) : e2->isEntityAPlayer();
+            if (!target || e2->dead()) continue;
+
+            vector2 last2 = e2->getLastCoords();
+            vector2 delta2 = e2->getPosition() - last2;
+            float radius2 = static_cast<float>(std::min(e2->getLength(), e2->getWidth())) / 2.0f;
+            float t;
+            if (sweepCircle(last, radius, delta - delta2, last2, radius2, t) && t < toi) {
+                toi = t;
+                hitWall = false;
+                hitTarget = true;
+                // same offset from the target as at the moment they touched, the target kept moving after it
+                stop = e2->getPosition() + (last + delta * t) - (last2 + delta2 * t);
+            }
+        }
+    }
+
+    if (!hitWall && !hitTarget) return;
+    e->setPosition(stop);
+    if (hitWall) {
+        e->removeHearts(e->getHearts());
+        if (e->getHearts() == 0) {
+            e->fail();
+        }
+    }
+}
+
 
 // Setters
 void GameManager::setProcessManager(sh_ptr<ProcessManager> pm) {
@@ -1661,13 +1733,117 @@ void GameManager::setWorld(sh_ptr<world> w) {
 
 // Attach Functions
 void GameManager::attachEntity(sh_ptr<entity> e) {
+    if (!indexEntity(e)) {
+        error("attachEntity: entity class does not match its type ", e->getEntityType());
+        return;
+    }
     entityList.push_back(e);
+    if (e->isEntityAnEnemyBoss()) {
+        bosses[e->getIndexSlot()]->setScheduler(sch);
+    }
     if (e->isEntityAPlayer()) {
         if (world_ptr != nullptr) {
             vector2 spawnPoint = world_ptr->getSpawnPoint();
             e->setPosition(spawnPoint);
         }
     }
+    gridUpdate(e);
+}
+
+
+// Entity Grid
+void GameManager::entityBounds(const sh_ptr_e& e, vector2& min, vector2& max) {
+    vector2 pos = e->getPosition();
+    if (e->isEntityALaser()) {
+        // a laser starts at its position and can point any way, so cover its full reach
+        float reach = static_cast<float>(e->getLength() + e->getWidth());
+        min = pos - vector2(reach, reach);
+        max = pos + vector2(reach, reach);
+        return;
+    }
+    AABB b = e->getBounds();
+    min = b.min;
+    max = b.max;
+}
+
+void GameManager::gridUpdate(const sh_ptr_e& e) {
+    vector2 min, max;
+    entityBounds(e, min, max);
+    if (e->getSpatialSlot() == SpatialHash<sh_ptr_e>::INVALID) {
+        e->setSpatialSlot(entityGrid.insert(e, min, max));
+    } else {
+        entityGrid.move(e->getSpatialSlot(), min, max);
+    }
+}
+
+// Typed Buckets
+// The one dynamic cast an entity gets, at attach time
+bool GameManager::indexEntity(const sh_ptr_e& e) {
+    switch (e->getEntityType()) {
+        case entity::PLAYER: {
+            auto p = std::dynamic_pointer_cast<Player>(e);
+            if (!p) return false;
+            p->setIndexSlot(0);
+            player = p;
+            return true;
+        }
+        case entity::ENEMY:
+            bucketAdd(enemies, e);
+            return true;
+        case entity::ENEMY_BOSS: {
+            auto b = std::dynamic_pointer_cast<Boss>(e);
+            if (!b) return false;
+            bucketAdd(bosses, b);
+            return true;
+        }
+        case entity::LASER: {
+            auto l = std::dynamic_pointer_cast<Laser>(e);
+            if (!l) return false;
+            bucketAdd(lasers, l);
+            return true;
+        }
+        case entity::PROJECTILE: {
+            auto p = std::dynamic_pointer_cast<Projectile>(e);
+            if (!p) return false;
+            bucketAdd(projectiles, p);
+            return true;
+        }
+        case entity::ITEM_PICKUP: {
+            int pickupType = e->getPickupType();
+            if (pickupType < 0 || pickupType >= static_cast<int>(pickups.size())) return false;
+            if (pickupType == entity::AT && !std::dynamic_pointer_cast<AT>(e)) return false;
+            bucketAdd(pickups[pickupType], e);
+            return true;
+        }
+    }
+    return false;
+}
+
+// Leaves entityList to the caller, takes the entity out of the grid and its bucket. Safe to call twice
+void GameManager::detachEntity(const sh_ptr_e& e) {
+    gridRemove(e);
+    switch (e->getEntityType()) {
+        case entity::PLAYER:
+            if (player == e) {player.reset();}
+            e->setIndexSlot(UINT32_MAX);
+            break;
+        case entity::ENEMY: bucketRemove(enemies, e); break;
+        case entity::ENEMY_BOSS: bucketRemove(bosses, e); break;
+        case entity::LASER: bucketRemove(lasers, e); break;
+        case entity::PROJECTILE: bucketRemove(projectiles, e); break;
+        case entity::ITEM_PICKUP:
+            clearPickupInteraction(e);
+            if (e->getPickupType() >= 0 && e->getPickupType() < static_cast<int>(pickups.size())) {
+                bucketRemove(pickups[e->getPickupType()], e);
+            }
+            break;
+    }
+}
+
+void GameManager::gridRemove(const sh_ptr_e& e) {
+    if (e->getSpatialSlot() == SpatialHash<sh_ptr_e>::INVALID) return;
+    entityGrid.remove(e->getSpatialSlot());
+    e->setSpatialSlot(SpatialHash<sh_ptr_e>::INVALID);
 }
 
 void GameManager::attachAseprite(const std::string& name, sh_ptr<AsepriteLoader> a) {
@@ -1693,20 +1869,11 @@ void GameManager::attachAnim(const std::string &name, sh_ptr<Animation> anim) {
 
 // Getters
 sh_ptr_ply GameManager::getPlayer() {
-    for (auto& e : entityList) {
-        if (e->isEntityAPlayer()) {
-            return std::dynamic_pointer_cast<Player>(e);
-        }
-    }
-    return nullptr;
+    return player;
 }
 sh_ptr_e GameManager::getBoss() {
-    for (auto& e : entityList) {
-        if (e->isEntityAnEnemyBoss()) {
-            return e;
-        }
-    }
-    return nullptr;
+    if (bosses.empty()) return nullptr;
+    return bosses.front();
 }
 
 
@@ -0,0 +1,132 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Peter Greek
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * Proper permission is grated by the copyright holder.
+ *
+ * Credit is attributed to the copyright holder in some form in the product.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+//
+// Created by xerxe on 10/18/2026.
+//
+
+#include "JobSystem.h"
+
+JobSystem::JobSystem(unsigned workerCount) {
+    for (unsigned i = 0; i <= workerCount; i++) {
+        queues.push_back(std::make_unique<WorkQueue>());
+    }
+    for (unsigned i = 1; i <= workerCount; i++) {
+        workers.emplace_back([this, i]() { workerLoop(i); });
+    }
+}
+
+JobSystem::~JobSystem() {
+    {
+        std::lock_guard<std::mutex> lock(wakeMutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    for (auto& t : workers) t.join();
+}
+
+void JobSystem::parallelFor(size_t count, size_t grain, const body_t& fn) {
+    if (count == 0) return;
+    if (grain == 0) grain = 1;
+    if (workers.empty() || count <= grain) {
+        fn(0, count);
+        return;
+    }
+
+    // body is read by whoever pops a range, the queue mutexes below publish it
+    size_t chunks = (count + grain - 1) / grain;
+    body = &fn;
+    remaining.store(chunks, std::memory_order_release);
+
+    // Deal contiguous runs of chunks to each queue so neighbouring processes stay on one core
+    size_t perQueue = (chunks + queues.size() - 1) / queues.size();
+    size_t chunk = 0;
+    for (auto& q : queues) {
+        std::lock_guard<std::mutex> lock(q->m);
+        for (size_t c = 0; c < perQueue && chunk < chunks; c++, chunk++) {
+            size_t begin = chunk * grain;
+            q->ranges.push_back({begin, std::min(begin + grain, count)});
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(wakeMutex);
+        batch++;
+    }
+    wake.notify_all();
+
+    while (remaining.load(std::memory_order_acquire) > 0) {
+        if (!runOne(0)) std::this_thread::yield();
+    }
+}
+
+void JobSystem::workerLoop(unsigned self) {
+    uint64_t seen = 0;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(wakeMutex);
+            wake.wait(lock, [&]() { return stopping || batch != seen; });
+            if (stopping) return;
+            seen = batch;
+        }
+
+        while (remaining.load(std::memory_order_acquire) > 0) {
+            if (!runOne(self)) std::this_thread::yield();
+        }
+    }
+}
+
+bool JobSystem::runOne(unsigned self) {
+    Range r{};
+    if (!popOwn(self, r) && !steal(self, r)) return false;
+    (*body)(r.begin, r.end);
+    remaining.fetch_sub(1, std::memory_order_acq_rel);
+    return true;
+}
+
+bool JobSystem::popOwn(unsigned self, Range& out) {
+    WorkQueue& q = *queues[self];
+    std::lock_guard<std::mutex> lock(q.m);
+    if (q.ranges.empty()) return false;
+    out = q.ranges.back();
+    q.ranges.pop_back();
+    return true;
+}
+
+bool JobSystem::steal(unsigned self, Range& out) {
+    for (size_t i = 1; i < queues.size(); i++) {
+        WorkQueue& q = *queues[(self + i) % queues.size()];
+        std::lock_guard<std::mutex> lock(q.m);
+        if (q.ranges.empty()) continue;
+        out = q.ranges.front();
+        q.ranges.pop_front();
+        return true;
+    }
+    return false;
+}
@@ -1,11 +1,18 @@
 // ProcessManager.cpp
 #include "ProcessManager.h"
+#include "config.h"
 #include <algorithm>
 
 int ProcessManager::updateProcessList(float deltaMs, SDL_Window *window) {
-    std::list<std::shared_ptr<xProcess>> removalList;
-
-    for (auto& p : processList) {
+    updating = true;
+
+    // Initialize and run main-thread updates. Processes attached during the walk land at the back and are still
+    // picked up this frame. Thread-safe updates are collected and run together afterwards.
+    parallelBatch.clear();
+    size_t updateCalls = 0;
+    size_t dormantSkipped = 0;
+    for (size_t i = 0; i < processList.size(); i++) {
+        xProcess* p = processList[i].get();
         if (p->state() == xProcess::UNINITIALIZED) {
             int result;
             if (p->isSDLSubProcess()) {
@@ -18,36 +25,72 @@ int ProcessManager::updateProcessList(float deltaMs, SDL_Window *window) {
         }
 
         if (p->state() == xProcess::RUNNING) {
+            if (p->isDormant() || (headlessMode && p->isSDLSubProcess())) { // SDL sub processes only draw
+                dormantSkipped++;
+            } else if (!p->isSDLSubProcess() && p->threadSafeUpdate()) {
+                parallelBatch.push_back(p);
+            } else {
+                p->update(deltaMs);
+                updateCalls++;
+            }
+        }
+    }
+    updateCalls += parallelBatch.size();
+    if constexpr (EventProfiler::enabled) EventProfiler::recordFrameUpdates(updateCalls, dormantSkipped);
+
+    if (parallelUpdates && parallelBatch.size() >= PARALLEL_UPDATE_MIN) {
+        if (!jobs) jobs = std::make_unique<JobSystem>();
+        jobs->parallelFor(parallelBatch.size(), PARALLEL_UPDATE_GRAIN, [this, deltaMs](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; i++) {
+                parallelBatch[i]->update(deltaMs);
+            }
+        });
+    } else {
+        for (auto* p : parallelBatch) {
             p->update(deltaMs);
         }
+    }
 
-        if (p->dead()) {
-            if (p->state() == xProcess::SUCCESS) {
-                p->postSuccess();
-                if (p->hasChild()) {
-                    print("Attaching child process: ", p->getChild());
-                    attachProcess(std::shared_ptr<xProcess>(p->getChild()));
-                }
-            } else if (p->state() == xProcess::FAIL) {
-                p->postFail();
-            } else if (p->state() == xProcess::ABORT) {
-                p->postAbort();
+    // Dead processes are swapped out in place, so the slot at i is looked at again
+    size_t i = 0;
+    while (i < processList.size()) {
+        xProcess* p = processList[i].get();
+        if (!p->dead()) {
+            i++;
+            continue;
+        }
+
+        if (p->state() == xProcess::SUCCESS) {
+            p->postSuccess();
+            if (p->hasChild()) {
+                print("Attaching child process: ", p->getChild());
+                attachProcess(std::shared_ptr<xProcess>(p->getChild()));
             }
-            removalList.push_back(p);
+        } else if (p->state() == xProcess::FAIL) {
+            p->postFail();
+        } else if (p->state() == xProcess::ABORT) {
+            p->postAbort();
         }
+        eraseAt(i);
     }
 
-    for (auto& p : removalList) {
-        removeProcess(p);
+    updating = false;
+    for (auto& handle : pendingRemovals) {
+        removeProcess(handle);
     }
-    removalList.clear();
+    pendingRemovals.clear();
 
     return 0;
 }
 
 void ProcessManager::attachProcess(std::shared_ptr<xProcess> p) {
-    p->setId(generateUUID());
-    processList.push_back(p);
+    xProcess* raw = p.get();
+    raw->setHandle(processList.insert(std::move(p)));
+
+    uint64_t order = nextAttachOrder++;
+    raw->setSubscribeHook([this, raw, order](EventId eventId, const EventManager::handlerList_t* handlers) {
+        subscribe(eventId, {raw, order, handlers});
+    });
 }
 
 void ProcessManager::attachProcess(xProcess* p) {
@@ -59,49 +102,135 @@ void ProcessManager::abortAllProcess() {
         p->abort();
         p->postAbort();
     }
+    for (auto& p : processList) {
+        unsubscribeAll(p.get());
+    }
     processList.clear();
+    pendingRemovals.clear();
 }
 
-int ProcessManager::removeProcess(const std::shared_ptr<xProcess>& p) {
-    processList.remove(p);
-    return 0;
+void ProcessManager::eraseAt(size_t index) {
+    xProcess* p = processList[index].get();
+    unsubscribeAll(p);
+    p->setHandle({});
+    processList.removeAt(index);
 }
 
-int ProcessManager::removeProcess(xProcess* p) {
-    auto it = std::find_if(processList.begin(), processList.end(),
-                           [p](const std::shared_ptr<xProcess>& process) { return process.get() == p; });
-    if (it != processList.end()) {
-        processList.erase(it);
+int ProcessManager::removeProcess(SlotHandle handle) {
+    auto* slot = processList.get(handle);
+    if (slot == nullptr) return -1; // stale handle, already removed
+    if (updating) {
+        pendingRemovals.push_back(handle); // don't pull it out from under updateProcessList
         return 0;
     }
-    return -1; // Process not found
+    eraseAt(slot - &*processList.begin());
+    return 0;
 }
 
-void ProcessManager::triggerEventInAll(const std::string &eventName, const json &eventData) {
-    for (auto& p : processList) {
-        if (p->dead()) continue;
-        p->onTriggerEvent(eventName, eventData);
+int ProcessManager::removeProcess(const std::shared_ptr<xProcess>& p) {
+    return removeProcess(p.get());
+}
+
+int ProcessManager::removeProcess(xProcess* p) {
+    auto* slot = processList.get(p->getHandle());
+    if (slot == nullptr || slot->get() != p) return -1; // Process not found
+    return removeProcess(p->getHandle());
+}
+
+std::shared_ptr<xProcess> ProcessManager::getProcess(SlotHandle handle) {
+    auto* slot = processList.get(handle);
+    return slot == nullptr ? nullptr : *slot;
+}
+
+void ProcessManager::triggerEventInAll(EventId eventId, const json &eventData) {
+    if constexpr (EventProfiler::enabled) EventProfiler::recordDispatch(eventId, eventData);
+
+    auto it = subscriberIndex.find(eventId);
+    if (it == subscriberIndex.end()) return;
+
+    // Handlers can attach, remove or subscribe processes, so the index only changes once the outermost dispatch is done
+    dispatchDepth++;
+    auto& subscribers = it->second;
+    for (size_t i = 0; i < subscribers.size(); i++) {
+        const Subscriber& s = subscribers[i];
+        if (s.process == nullptr || s.process->dead()) continue;
+        for (auto& handler : *s.handlers) {
+            if constexpr (EventProfiler::enabled) {
+                auto start = EventProfiler::clock_t::now();
+                handler(eventData);
+                EventProfiler::recordHandler(eventId, start);
+            } else {
+                handler(eventData);
+            }
+        }
+    }
+    dispatchDepth--;
+
+    if (dispatchDepth == 0) {
+        flushSubscriberIndex();
     }
 }
 
-bool ProcessManager::containsUUID(UUID_t uuid) {
-    return std::find(uuidList.begin(), uuidList.end(), uuid) != uuidList.end();
+void ProcessManager::subscribe(EventId eventId, const Subscriber& subscriber) {
+    if (dispatchDepth > 0) {
+        pendingSubscribers.push_back({eventId, subscriber});
+        return;
+    }
+    auto& subscribers = subscriberIndex[eventId];
+    auto pos = std::upper_bound(subscribers.begin(), subscribers.end(), subscriber.order,
+                                [](uint64_t o, const Subscriber& s) { return o < s.order; });
+    subscribers.insert(pos, subscriber);
 }
 
-UUID_t ProcessManager::generateUUID() {
-    UUID_t uuid;
-    do {
-        uuid = "pm-xxxxxx-4xxx-yxxx";
-        for (int i = 0; i < uuid.length(); ++i) {
-            if (uuid[i] == 'x') {
-                uuid[i] = "0123456789abcdef"[rand() % 16];
-            } else if (uuid[i] == 'y') {
-                uuid[i] = "89ab"[rand() % 4];
+void ProcessManager::unsubscribeAll(xProcess* p) {
+    p->setSubscribeHook(nullptr);
+    pendingSubscribers.erase(std::remove_if(pendingSubscribers.begin(), pendingSubscribers.end(),
+                                            [p](const auto& pending) { return pending.second.process == p; }),
+                             pendingSubscribers.end());
+
+    for (auto& eventId : p->getSubscribedEvents()) {
+        auto it = subscriberIndex.find(eventId);
+        if (it == subscriberIndex.end()) continue;
+        auto& subscribers = it->second;
+        if (dispatchDepth > 0) {
+            for (auto& s : subscribers) {
+                if (s.process == p) s.process = nullptr; // cleaned up in flushSubscriberIndex
             }
+            indexHasHoles = true;
+            continue;
+        }
+        subscribers.erase(std::remove_if(subscribers.begin(), subscribers.end(),
+                                         [p](const Subscriber& s) { return s.process == p; }),
+                          subscribers.end());
+        if (subscribers.empty()) subscriberIndex.erase(it);
+    }
+}
+
+void ProcessManager::flushSubscriberIndex() {
+    if (indexHasHoles) {
+        for (auto it = subscriberIndex.begin(); it != subscriberIndex.end();) {
+            auto& subscribers = it->second;
+            subscribers.erase(std::remove_if(subscribers.begin(), subscribers.end(),
+                                             [](const Subscriber& s) { return s.process == nullptr; }),
+                              subscribers.end());
+            it = subscribers.empty() ? subscriberIndex.erase(it) : std::next(it);
         }
-    } while (containsUUID(uuid));
+        indexHasHoles = false;
+    }
 
-    uuidList.push_back(uuid);
-    return uuid;
+    if (pendingSubscribers.empty()) return;
+    auto pending = std::move(pendingSubscribers);
+    pendingSubscribers.clear();
+    for (auto& [eventId, s] : pending) {
+        subscribe(eventId, s);
+    }
 }
 
+size_t ProcessManager::subscriberCount(EventId eventId) const {
+    auto it = subscriberIndex.find(eventId);
+    return it == subscriberIndex.end() ? 0 : it->second.size();
+}
+
+bool ProcessManager::containsId(ProcessId_t id) const {
+    return processList.contains(SlotHandle::unpack(id));
+}
@@ -44,7 +44,7 @@ using json = nlohmann::json;
 
 class WorldCreator : public xProcess {
 public:
-    explicit WorldCreator(passFunc_t func) : xProcess(true, std::move(func)) {}
+    explicit WorldCreator(passFunc_t func) : xProcess(true, std::move(func)) { setDormant(true); }
 
     int initialize_SDL_process(SDL_Window* window) override;
     void update(float deltaMs) override {}
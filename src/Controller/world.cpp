@@ -31,6 +31,7 @@ void world::loadWorld() {
             }
         }
     }
+    rebuildWallGrid();
 }
 
 void world::saveWorld() {
@@ -46,7 +47,14 @@ jLoader& world::getWorldData() {
 void world::updateWall(int roomId, int wallId, wall* w) {
     auto roomIt = std::next(roomList.begin(), roomId);
     auto wallIt = std::next(roomIt->begin(), wallId);
+    wall* old = *wallIt;
     *wallIt = w;
+    std::replace(wallList.begin(), wallList.end(), old, w);
+    // the wall may have been edited in place, so its corners and grid cells are refreshed either way
+    w->updateShape();
+    gridRemoveWall(old);
+    gridRemoveWall(w);
+    gridAddWall(w);
 }
 
 int world::addRoom() {
@@ -60,6 +68,9 @@ int world::addRoom() {
 int world::addWall(int roomId, wall* w) {
     auto roomIt = std::next(roomList.begin(), roomId);
     roomIt->push_back(w);
+    w->updateShape();
+    wallList.push_back(w);
+    gridAddWall(w);
     worldData["rooms"][roomId]["walls"].push_back(w);
     saveWorld();
     return worldData["rooms"][roomId]["walls"].size() - 1;
@@ -67,6 +78,10 @@ int world::addWall(int roomId, wall* w) {
 
 void world::deleteRoom(int roomId) {
     auto roomIt = std::next(roomList.begin(), roomId);
+    for (auto& w : *roomIt) {
+        wallList.remove(w);
+        gridRemoveWall(w);
+    }
     roomList.erase(roomIt);
     worldData["rooms"].erase(worldData["rooms"].begin() + roomId);
     saveWorld();
@@ -75,6 +90,8 @@ void world::deleteRoom(int roomId) {
 void world::deleteWall(int roomId, int wallId) {
     auto roomIt = std::next(roomList.begin(), roomId);
     auto wallIt = std::next(roomIt->begin(), wallId);
+    wallList.remove(*wallIt);
+    gridRemoveWall(*wallIt);
     roomIt->erase(wallIt);
     worldData["rooms"][roomId]["walls"].erase(worldData["rooms"][roomId]["walls"].begin() + wallId);
     if (worldData["rooms"][roomId]["walls"].empty()) {
@@ -92,21 +109,52 @@ roomList_t world::getRoomList() {
 }
 
 bool world::isPointInWall(vector2 vec) {
-    for (auto& w : wallList) {
-        if (w->isPointInWall(vec)) {
-            return true;
-        }
-    }
-    return false;
+    return wallGrid.firstContaining(vec) != OBBGrid::INVALID;
+}
+
+bool world::isRectInWall(const AABB& box) {
+    return wallGrid.firstOverlapping(box) != OBBGrid::INVALID;
+}
+
+bool world::sweepRectInWall(const AABB& box, vector2 delta, float& toi) {
+    return wallGrid.firstSwept(box, delta, toi) != OBBGrid::INVALID;
+}
+
+float world::raycast(vector2 origin, vector2 dir, float maxDist) {
+    float fraction;
+    wallGrid.firstOnSegment(origin, origin + dir * maxDist, fraction);
+    return fraction * maxDist;
 }
 
-bool world::isRectInWall(vectorList_t& rect) {
+bool world::hasLineOfSight(vector2 from, vector2 to) {
+    float fraction;
+    return wallGrid.firstOnSegment(from, to, fraction) == OBBGrid::INVALID;
+}
+
+void world::segmentsToWalls(const std::vector<vector2>& from, const std::vector<vector2>& to,
+                            std::vector<float>& fraction) {
+    fraction.resize(from.size());
+    wallGrid.segmentsFirstHit(from.data(), to.data(), from.size(), fraction.data());
+}
+
+void world::rebuildWallGrid() {
+    wallGrid.clear();
+    wallSlots.clear();
     for (auto& w : wallList) {
-        if (w->isRectangleInWall(rect)) {
-            return true;
-        }
+        gridAddWall(w);
     }
-    return false;
+}
+
+void world::gridAddWall(wall* w) {
+    if (w == nullptr || wallSlots.count(w)) return;
+    wallSlots[w] = wallGrid.insert(w->box);
+}
+
+void world::gridRemoveWall(wall* w) {
+    auto it = wallSlots.find(w);
+    if (it == wallSlots.end()) return;
+    wallGrid.remove(it->second);
+    wallSlots.erase(it);
 }
 
 vector2 world::getSpawnPoint() {
@@ -183,7 +231,7 @@ vector2 getDoorCenter(const json& door) {
     vector2 base = door["coords"].get<vector2>();
     float heading = door["h"].get<float>();
     float length = door["l"].get<float>();
-    vector2 dir = angleToVector2(Heading(heading)).normalize();
+    vector2 dir = angleToVector2(Heading(heading));
     return base + dir * (length / 2.0f);
 }
 
@@ -588,6 +636,7 @@ void world::generateLayout(int count) {
         }
         roomList.push_back(newWallList);
     }
+    rebuildWallGrid();
 }
 
 json world::pickUsedSpecialRoom(const json& templates) {
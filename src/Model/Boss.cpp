@@ -3,20 +3,57 @@
 //
 
 #include "Boss.h"
+#include <cmath>
 
 
 
-void Boss::update(float deltaMs) {
-    lastMinionSpawnTime += deltaMs;
-    if (lastMinionSpawnTime > timeBetweenSpawnsMinion) {
-        lastMinionSpawnTime = timeBetweenSpawnsMinion;
+Boss::~Boss() {
+    if (sch) {
+        sch->cancelTask(minionCooldown);
+        sch->cancelTask(projectileCooldown);
     }
+}
+
+void Boss::setScheduler(sh_ptr<Scheduler> scheduler) {
+    sch = std::move(scheduler);
+    restartCooldown(minionCooldown, minionReady, minionCooldownStart, minionInterval());
+    restartCooldown(projectileCooldown, projectileReady, projectileCooldownStart, projectileInterval());
+}
+
+Task Boss::cooldown(bool& ready, int ms) {
+    co_await seconds(static_cast<float>(ms) / 1000.0f);
+    ready = true;
+}
+
+void Boss::restartCooldown(TaskHandle& task, bool& ready, double& start, int ms) {
+    ready = false;
+    if (!sch) return;
+    start = sch->getGameClockMs();
+    sch->cancelTask(task);
+    task = sch->startTask(cooldown(ready, ms));
+}
 
-    lastProjectileSpawnTime += deltaMs;
-    if (lastProjectileSpawnTime > timeBetweenSpawnsProjectile) {
-        lastProjectileSpawnTime = timeBetweenSpawnsProjectile;
+// A running cooldown now only waits out what is left of ms since it started
+void Boss::shortenCooldown(TaskHandle& task, bool& ready, double start, int ms) {
+    if (ready || !sch) return;
+    sch->cancelTask(task);
+    double left = static_cast<double>(ms) - (sch->getGameClockMs() - start);
+    if (left <= 0) {
+        ready = true;
+        return;
     }
+    task = sch->startTask(cooldown(ready, static_cast<int>(std::ceil(left))));
+}
+
+int Boss::minionInterval() const {
+    return rageStarted ? timeBetweenSpawnsMinionRage : timeBetweenSpawnsMinion;
+}
 
+int Boss::projectileInterval() const {
+    return rageStarted ? timeBetweenSpawnsProjectile / 3 : timeBetweenSpawnsProjectile;
+}
+
+void Boss::update(float deltaMs) {
     std::vector<sh_ptr_e> removalList; // prevent segfaults
     for (auto& m : minions) {
         if (m->isDone() || m->state() == xProcess::State::ABORT || m->state() == xProcess::State::FAIL) {
@@ -38,16 +75,16 @@ void Boss::update(float deltaMs) {
         }
     }
 
-    if (getHearts() < getMaxHearts() / 2) {
-        inRage += deltaMs;
-        timeBetweenSpawnsMinion = 10000;
-    } else {
-        inRage = 0;
+    // Rage sticks once reached, and the faster intervals apply to the cooldowns already running
+    if (!rageStarted && inRageMode()) {
+        rageStarted = true;
+        shortenCooldown(minionCooldown, minionReady, minionCooldownStart, minionInterval());
+        shortenCooldown(projectileCooldown, projectileReady, projectileCooldownStart, projectileInterval());
     }
 }
 
 bool Boss::inRageMode() const {
-    return inRage > 0;
+    return getHearts() < getMaxHearts() / 2;
 }
 
 bool Boss::isMinion(const sh_ptr_e& e) const {
@@ -62,7 +99,7 @@ void Boss::attachMinion(const sh_ptr_e& e) {
     if (minionCount < maxMinions) {
         minions.push_back(e);
         minionCount++;
-        lastMinionSpawnTime = 0;
+        restartCooldown(minionCooldown, minionReady, minionCooldownStart, minionInterval());
     }
 }
 
@@ -70,7 +107,7 @@ void Boss::attachProjectile(const sh_ptr_e& e) {
     if (projectileCount < maxProjectiles) {
         projectiles.push_back(e);
         projectileCount++;
-        lastProjectileSpawnTime = 0;
+        restartCooldown(projectileCooldown, projectileReady, projectileCooldownStart, projectileInterval());
     }
 }
 
@@ -98,7 +135,7 @@ int Boss::getToSpawnMinionCount() const {
 bool Boss::canSpawnMinion() const {
     // if the time is more than the interval and the count is less than
     // the max, then spawn a minion
-    if (lastMinionSpawnTime >= timeBetweenSpawnsMinion && minionCount < maxMinions) {
+    if (minionReady && minionCount < maxMinions) {
         return true;
     }
     return false;
@@ -124,7 +161,7 @@ int Boss::getToSpawnProjectileCount() const {
 }
 
 bool Boss::canSpawnProjectile() const {
-    return lastProjectileSpawnTime >= (inRageMode() ? timeBetweenSpawnsProjectile/3 : timeBetweenSpawnsProjectile) && projectileCount + 4 < maxProjectiles;
+    return projectileReady && projectileCount + 4 < maxProjectiles;
 }
 
 sh_ptr_e Boss::spawnProjectile(vector2 coords) {
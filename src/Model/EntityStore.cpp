@@ -0,0 +1,146 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2025 Peter Greek
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * Proper permission is grated by the copyright holder.
+ *
+ * Credit is attributed to the copyright holder in some form in the product.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+
+//
+// Created by xerxe on 10/18/2026.
+//
+
+#include "EntityStore.h"
+#include "config.h"
+
+// Swap remove for every column, so the last row fills the hole
+template <typename Columns>
+static void swapRemove(Columns& c, size_t r) {
+    size_t last = c.size() - 1;
+    if (r != last) c[r] = std::move(c[last]);
+    c.pop_back();
+}
+
+uint32_t EntityStore::create(int type, vector2 position, int length, int width, int hearts) {
+    uint32_t id;
+    if (!freeIds.empty()) {
+        id = freeIds.back();
+        freeIds.pop_back();
+    } else {
+        id = static_cast<uint32_t>(row.size());
+        row.push_back(INVALID);
+        projectileRow.push_back(INVALID);
+    }
+
+    row[id] = static_cast<uint32_t>(rows.position.size());
+    rows.position.push_back(position);
+    rows.lastPosition.push_back(position);
+    rows.velocity.emplace_back(0.0f, 0.0f);
+    rows.spawnPosition.push_back(position);
+    rows.length.push_back(length);
+    rows.width.push_back(width);
+    rows.hearts.push_back(hearts);
+    rows.maxHearts.push_back(hearts);
+    rows.type.push_back(static_cast<uint8_t>(type));
+    rows.flags.push_back(0);
+    rows.knockbackTime.push_back(0.0f);
+    rows.invincibleTime.push_back(0.0f);
+    rows.id.push_back(id);
+    return id;
+}
+
+void EntityStore::destroy(uint32_t id) {
+    if (id >= row.size() || row[id] == INVALID) return;
+    removeProjectile(id);
+
+    size_t r = row[id];
+    uint32_t moved = rows.id.back();
+    swapRemove(rows.position, r);
+    swapRemove(rows.lastPosition, r);
+    swapRemove(rows.velocity, r);
+    swapRemove(rows.spawnPosition, r);
+    swapRemove(rows.length, r);
+    swapRemove(rows.width, r);
+    swapRemove(rows.hearts, r);
+    swapRemove(rows.maxHearts, r);
+    swapRemove(rows.type, r);
+    swapRemove(rows.flags, r);
+    swapRemove(rows.knockbackTime, r);
+    swapRemove(rows.invincibleTime, r);
+    swapRemove(rows.id, r);
+    if (moved != id) row[moved] = static_cast<uint32_t>(r);
+
+    row[id] = INVALID;
+    freeIds.push_back(id);
+}
+
+void EntityStore::addProjectile(uint32_t id, float range) {
+    if (projectileRow[id] != INVALID) {
+        projectiles.range[projectileRow[id]] = range;
+        return;
+    }
+    projectileRow[id] = static_cast<uint32_t>(projectiles.range.size());
+    projectiles.range.push_back(range);
+    projectiles.id.push_back(id);
+}
+
+void EntityStore::removeProjectile(uint32_t id) {
+    uint32_t r = projectileRow[id];
+    if (r == INVALID) return;
+    uint32_t moved = projectiles.id.back();
+    swapRemove(projectiles.range, r);
+    swapRemove(projectiles.id, r);
+    if (moved != id) projectileRow[moved] = r;
+    projectileRow[id] = INVALID;
+}
+
+void EntityStore::integrate(float deltaMs) {
+    const size_t count = rows.position.size();
+    vector2* pos = rows.position.data();
+    vector2* last = rows.lastPosition.data();
+    const vector2* vel = rows.velocity.data();
+    const float maxY = WORLD_MAX_Y - 10;
+    for (size_t i = 0; i < count; i++) {
+        last[i] = pos[i];
+        pos[i] += vel[i] * deltaMs;
+        if (pos[i].y < WORLD_MIN_Y) {
+            pos[i].y = WORLD_MIN_Y;
+        } else if (pos[i].y > maxY) {
+            pos[i].y = maxY;
+        }
+    }
+}
+
+void EntityStore::cull(vector2 min, vector2 max, float alpha) {
+    const size_t count = rows.position.size();
+    const vector2* pos = rows.position.data();
+    const vector2* last = rows.lastPosition.data();
+    uint8_t* flags = rows.flags.data();
+    for (size_t i = 0; i < count; i++) {
+        vector2 p = last[i] + (pos[i] - last[i]) * alpha;
+        bool inView = p.x >= min.x && p.x <= max.x && p.y >= min.y && p.y <= max.y;
+        flags[i] = inView ? (flags[i] | IN_VIEW) : (flags[i] & ~IN_VIEW);
+    }
+}
@@ -110,6 +110,19 @@ float Laser::timeLeft() {
     return duration - inFire;
 }
 
+Heading Laser::getBeamHeading() {
+    return beamLength < 0 ? dir : beamHeading;
+}
+
+float Laser::getBeamLength() {
+    return beamLength < 0 ? static_cast<float>(getLength()) : beamLength;
+}
+
+void Laser::setBeam(Heading h, float l) {
+    beamHeading = h;
+    beamLength = l;
+}
+
 
 
 
@@ -43,29 +43,37 @@ void entity::update(float deltaMs) {
 }
 
 bool entity::isDone() {
-    return created && !spawned;
+    return created && !inWorld();
 }
 
 void entity::spawn() {
-    spawned = true;
+    EntityStore::setFlag(id, EntityStore::SPAWNED, true);
 }
 
 bool entity::inWorld() const {
-    return spawned;
+    return EntityStore::hasFlag(id, EntityStore::SPAWNED);
 }
 
 vector2 entity::getSpawnCoords() {
-    return spawnCoords;
+    return EntityStore::spawnPosition(id);
+}
+
+uint32_t entity::getStoreId() const {
+    return id;
+}
+
+bool entity::isInView() const {
+    return EntityStore::hasFlag(id, EntityStore::IN_VIEW);
 }
 
 // Entity Type Methods
-entity::eType entity::getEntityType() const {return type;}
-bool entity::isEntityAPlayer() {return type == PLAYER;};
-bool entity::isEntityAnEnemy() {return type == ENEMY;};
-bool entity::isEntityAnEnemyBoss() {return type == ENEMY_BOSS;};
-bool entity::isEntityALaser() {return type == LASER;}
-bool entity::isEntityAPickup() {return type == ITEM_PICKUP;};
-bool entity::isEntityAProjectile() {return type == PROJECTILE;};
+entity::eType entity::getEntityType() const {return static_cast<eType>(EntityStore::type(id));}
+bool entity::isEntityAPlayer() {return getEntityType() == PLAYER;};
+bool entity::isEntityAnEnemy() {return getEntityType() == ENEMY;};
+bool entity::isEntityAnEnemyBoss() {return getEntityType() == ENEMY_BOSS;};
+bool entity::isEntityALaser() {return getEntityType() == LASER;}
+bool entity::isEntityAPickup() {return getEntityType() == ITEM_PICKUP;};
+bool entity::isEntityAProjectile() {return getEntityType() == PROJECTILE;};
 
 entity::pType entity::getPickupType() {
     int rel = getMaxHearts();
@@ -75,22 +83,25 @@ entity::pType entity::getPickupType() {
 
 // Health Methods
 int entity::getHearts() const {
-    return hearts;
+    return EntityStore::hearts(id);
 };
 void entity::setHearts(int newHearts) {
+    int& hearts = EntityStore::hearts(id);
     hearts = newHearts;
-    if (hearts > maxHearts) {
-        hearts = maxHearts;
+    if (hearts > getMaxHearts()) {
+        hearts = getMaxHearts();
     }
 };
 void entity::addHearts(int heartsToAdd) {
+    int& hearts = EntityStore::hearts(id);
     hearts += heartsToAdd;
-    if (hearts > maxHearts) {
-        hearts = maxHearts;
+    if (hearts > getMaxHearts()) {
+        hearts = getMaxHearts();
     }
 };
 void entity::removeHearts(int heartsToRemove) {
-    if (isInvincible) {return;}
+    if (isEntityInvincible()) {return;}
+    int& hearts = EntityStore::hearts(id);
     hearts -= heartsToRemove;
     if (hearts < 0) {
         hearts = 0;
@@ -99,24 +110,26 @@ void entity::removeHearts(int heartsToRemove) {
 
 // Max Health Methods
 int entity::getMaxHearts() const {
-    return maxHearts;
+    return EntityStore::maxHearts(id);
 };
 void entity::setMaxHearts(int newMaxHearts) {
-    maxHearts = newMaxHearts;
+    EntityStore::maxHearts(id) = newMaxHearts;
 }
 
 // Position Methods
 void entity::setPosition(vector2 newPosition) {
-    coords = newPosition;
+    EntityStore::position(id) = newPosition;
+    EntityStore::lastPosition(id) = newPosition; // teleports and wall pushback should not be interpolated
 };
 
 vector2 entity::getPosition() {
-    return coords;
+    return EntityStore::position(id);
 }
 
 void entity::updateCoordsFromVelocity(float deltaMs) {
-    lastCoords = {coords.x, coords.y};
-    coords += vel * deltaMs;
+    vector2& coords = EntityStore::position(id);
+    EntityStore::lastPosition(id) = coords;
+    coords += EntityStore::velocity(id) * deltaMs;
 
     if (coords.y < WORLD_MIN_Y) {
         coords.y = WORLD_MIN_Y;
@@ -126,108 +139,115 @@ void entity::updateCoordsFromVelocity(float deltaMs) {
 }
 
 vector2 entity::getLastCoords() {
-    return lastCoords;
+    return EntityStore::lastPosition(id);
+}
+
+vector2 entity::getRenderPosition(float alpha) const {
+    vector2 last = EntityStore::lastPosition(id);
+    return last + (EntityStore::position(id) - last) * alpha;
 }
 
 // Velocity Methods
 void entity::setVelocity(vector2 newVelocity) {
-    vel = newVelocity;
+    EntityStore::velocity(id) = newVelocity;
 };
 
 vector2 entity::getVelocity() {
-    return vel;
+    return EntityStore::velocity(id);
 }
 
 // Knockback Methods
 bool entity::isKnockedBack() const {
-    return inKnockback;
+    return EntityStore::hasFlag(id, EntityStore::KNOCKED_BACK);
 }
 
 float entity::remainingKnockback() const {
-    return knockbackRemaining;
+    return EntityStore::knockbackTime(id);
 }
 
 void entity::setKnockedBack(bool knockedBack, float knockbackTime) {
-    inKnockback = knockedBack;
-    knockbackRemaining = knockbackTime;
+    EntityStore::setFlag(id, EntityStore::KNOCKED_BACK, knockedBack);
+    EntityStore::knockbackTime(id) = knockbackTime;
 }
 
 int entity::getLength() const {
-    return length;
+    return EntityStore::length(id);
 }
 
 int entity::getWidth() const {
-    return width;
+    return EntityStore::width(id);
+}
+
+uint32_t entity::getSpatialSlot() const {
+    return spatialSlot;
+}
+
+void entity::setSpatialSlot(uint32_t slot) {
+    spatialSlot = slot;
+}
+
+uint32_t entity::getIndexSlot() const {
+    return indexSlot;
+}
+
+void entity::setIndexSlot(uint32_t slot) {
+    indexSlot = slot;
 }
 
 vector2 entity::getCenter() const {
-    return {coords.x + length / 2, coords.y + width / 2};
+    vector2 coords = EntityStore::position(id);
+    return {coords.x + getLength() / 2, coords.y + getWidth() / 2};
 }
 
 vector2 entity::getDimensions() const {
-    return {static_cast<float>(length), static_cast<float>(width)};
+    return {static_cast<float>(getLength()), static_cast<float>(getWidth())};
 }
 
 bool entity::isEntityInvincible() const {
-    return isInvincible;
+    return EntityStore::hasFlag(id, EntityStore::INVINCIBLE);
 }
 
 void entity::setEntityInvincible(bool invincible) {
-    isInvincible = invincible;
+    EntityStore::setFlag(id, EntityStore::INVINCIBLE, invincible);
 }
 
 void entity::setEntityInvincible(bool invincible, float time) {
-    isInvincible = invincible;
-    invincibleTime = time;
+    EntityStore::setFlag(id, EntityStore::INVINCIBLE, invincible);
+    EntityStore::invincibleTime(id) = time;
 }
 
 void entity::setEntityInvincibleTime(float time) {
-    invincibleTime = time;
+    EntityStore::invincibleTime(id) = time;
 }
 
 void entity::updateInvincibility(float deltaMs) {
+    float& invincibleTime = EntityStore::invincibleTime(id);
     if (invincibleTime > 0) {
         invincibleTime -= deltaMs;
         if (invincibleTime <= 0) {
             invincibleTime = 0;
-            isInvincible = false;
+            EntityStore::setFlag(id, EntityStore::INVINCIBLE, false);
         }
     }
 }
 
+AABB entity::getBounds() const {
+    return AABB::fromCenter(EntityStore::position(id), vector2(getLength() / 2.0f, getWidth() / 2.0f));
+}
+
 bool entity::isPointInEntity(vector2 point) const {
-    vector2 p1 = coords + vector2(-length/2, width/2); // Top-left
-    vector2 p2 = coords + vector2(length/2, width/2); // Top-right
-    vector2 p3 = coords + vector2(length/2, -width/2); // Bottom-right
-    vector2 p4 = coords + vector2(-length/2, -width/2); // Bottom-left
-    return isPointInBounds(point, {p1, p2, p3, p4});
+    return getBounds().contains(point);
 }
 
 void entity::setLength(int newLength) {
-    length = newLength;
+    EntityStore::length(id) = newLength;
 }
 
 void entity::setWidth(int newWidth) {
-    width = newWidth;
+    EntityStore::width(id) = newWidth;
 }
 
 bool entity::isEntityInEntity(const sh_ptr_e& other) const {
     if (other == nullptr) return false;
-    vector2 o_p1 = other->getPosition() + vector2(-other->getLength()/2, other->getWidth()/2); // Top-left
-    vector2 o_p2 = other->getPosition() + vector2(other->getLength()/2, other->getWidth()/2); // Top-right
-    vector2 o_p3 = other->getPosition() + vector2(other->getLength()/2, -other->getWidth()/2); // Bottom-right
-    vector2 o_p4 = other->getPosition() + vector2(-other->getLength()/2, -other->getWidth()/2); // Bottom-left
-
-    vector2 p1 = coords + vector2(-length/2, width/2); // Top-left
-    vector2 p2 = coords + vector2(length/2, width/2); // Top-right
-    vector2 p3 = coords + vector2(length/2, -width/2); // Bottom-right
-    vector2 p4 = coords + vector2(-length/2, -width/2); // Bottom-left
-
-    vectorList_t oPList = {o_p1, o_p2, o_p3, o_p4};
-
-    return  isPointInBounds(coords, oPList) ||
-            isPointInBounds(p1, oPList) ||
-            isPointInBounds(p2, oPList) ||
-            isPointInBounds(p3, oPList) ||
-            isPointInBounds(p4, oPList);
-}
\ No newline at end of file
+    return getBounds().overlaps(other->getBounds());
+}
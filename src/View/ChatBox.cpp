@@ -76,7 +76,7 @@ int ChatBox::onInputMessage(std::string message) {
         return 1;
     }
     args.erase(args.begin());
-    TriggerEvent("__internal_command_" + command, "chat", args, message);
+    TriggerEvent(EventId::command(command), "chat", args, message);
     UserInput::addMessage("Executed Command: " + command);
     return 1;
 }
@@ -2,7 +2,7 @@
 #include <SDL_image.h>
 
 Cursor::Cursor(passFunc_t passFunc)
-        : xProcess(true, passFunc) {}
+        : xProcess(true, passFunc) { setDormant(true); }
 
 Cursor::~Cursor() {
     cleanup();
@@ -226,8 +226,8 @@ int SettingsMenu::initialize_SDL_process(SDL_Window *passed_window) {
                     SDL_Rect handleRect = {handleX - 5, barY - 5, handleWidth, handleHeight};
                     SDL_SetRenderDrawColor(renderer, 0, 200, 255, 255); // Cyan handle
 //                    SDL_RenderFillRect(renderer, &handleRect);
-                    TriggerEvent("SDL::Render::DrawCircle", handleX, barY + barHeight / 2, handleWidth/2);
-                    TriggerEvent("SDL::Render::FillCircle", handleX, barY + barHeight / 2, handleWidth/2);
+                    TriggerEvent(SDL::Render::DrawCircle{handleX, barY + barHeight / 2, handleWidth/2});
+                    TriggerEvent(SDL::Render::FillCircle{handleX, barY + barHeight / 2, handleWidth/2});
                     handlerHitboxes.push_back({handleRect, s.name});
                     y_offset += getScaledPixelHeight(40);  // Space below slider
                     return;
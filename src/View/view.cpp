@@ -36,6 +36,11 @@
 #include "view.h"
 #include "../Controller/WorldCreator.h"
 #include "Cursor.h"
+#include "Benchmark.h"
+#include "EventProfiler.h"
+#include "FrameTimer.h"
+#include <sstream>
+#include <iomanip>
 
 #ifdef __WIN32__
 #include <windows.h>
@@ -99,6 +104,12 @@ int view::initialize() {
 
     print("View Initialize");
 
+    if (headlessMode) {
+        // No display or sound device needed, the dummy drivers still hand out a window, renderer and mixer
+        SDL_setenv("SDL_VIDEODRIVER", "dummy", 1);
+        SDL_setenv("SDL_AUDIODRIVER", "dummy", 1);
+    }
+
     if (SDL_Init(SDL_INIT_VIDEO) < 0) {
         error("SDL could not initialize!", SDL_GetError());
         return 0;
@@ -149,7 +160,7 @@ int view::initialize() {
                               SDL_WINDOWPOS_CENTERED,
                               SDL_WINDOWPOS_CENTERED,
                               SCREEN_WIDTH, SCREEN_HEIGHT,
-                              SDL_WINDOW_ALLOW_HIGHDPI | SDL_WINDOW_SHOWN);
+                              SDL_WINDOW_ALLOW_HIGHDPI | (headlessMode ? SDL_WINDOW_HIDDEN : SDL_WINDOW_SHOWN));
 
     if (!window) {
         error("Window could not be created!", SDL_GetError());
@@ -162,7 +173,7 @@ int view::initialize() {
     #ifdef __APPLE__
         renderer = SDL_CreateRenderer(window, -1, SDL_RENDERER_SOFTWARE);
     #else
-        renderer = SDL_CreateRenderer(window, -1, SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC);
+        renderer = SDL_CreateRenderer(window, -1, headlessMode ? SDL_RENDERER_SOFTWARE : SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC);
     #endif
 
     if (!renderer) {
@@ -275,10 +286,64 @@ int view::initialize() {
         SDL_RenderFillCircle(x, y, radius);
     });
 
+    // Typed render primitives, these are what the game uses every frame
+    AddEventHandler<SDL::Render::DrawRect>([this](const SDL::Render::DrawRect& e) {
+        drawRect((int)e.x, (int)e.y, (int)e.w, (int)e.h);
+    });
+
+    AddEventHandler<SDL::Render::DrawPoint>([this](const SDL::Render::DrawPoint& e) {
+        SDL_RenderDrawPoint(renderer, (int)e.x, (int)e.y);
+    });
+
+    AddEventHandler<SDL::Render::DrawPointFromVector>([this](const SDL::Render::DrawPointFromVector& e) {
+        SDL_RenderDrawPoint(renderer, (int)e.point.x, (int)e.point.y);
+    });
+
+    AddEventHandler<SDL::Render::SetDrawColor>([this](const SDL::Render::SetDrawColor& e) {
+        SDL_SetRenderDrawColor(renderer, e.r, e.g, e.b, e.a);
+    });
+
+    AddEventHandler<SDL::Render::ResetDrawColor>([this](const SDL::Render::ResetDrawColor&) {
+        SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255);
+    });
+
+    AddEventHandler<SDL::Render::DrawCircle>([this](const SDL::Render::DrawCircle& e) {
+        SDL_RenderDrawCircle(e.x, e.y, e.radius);
+    });
+
+    AddEventHandler<SDL::Render::FillCircle>([this](const SDL::Render::FillCircle& e) {
+        SDL_RenderFillCircle(e.x, e.y, e.radius);
+    });
+
     AddEventHandler("UFO::Chat::State", [this](bool state) {
         chatState = state;
     });
 
+    // Hotkeys, handled in event order so a chat box opened earlier in the same batch is respected
+    AddEventHandler("SDL::OnPollEvent", [this](int eventType, int key) {
+        if (eventType != SDL_KEYDOWN) return;
+        if (!chatState) {
+            if (key == SDLK_q) {
+                TriggerEvent("UFO::Quit");
+                running = false;
+            }
+            if (key == SDLK_b) {
+                TriggerEvent("UFO::ChangeConfigValue", "debugMode");
+            }
+
+            if (key == SDLK_f) {
+                TriggerEvent("UFO::ChangeConfigValue", "unlimitedFrames");
+            }
+
+        }else {
+            const Uint8 *keyboard_state_array = SDL_GetKeyboardState(nullptr);
+            // if control q is pressed then quit
+            if (keyboard_state_array[SDL_SCANCODE_LCTRL] && key == SDLK_q) {
+                running = false;
+            }
+        }
+    });
+
     running = true;
 
     // Init other processes
@@ -311,6 +376,8 @@ int view::initialize() {
     pM->attachProcess(WC);
     chatBox->addMessage("World Creator Attached");
 
+    pM->attachProcess(std::make_shared<Benchmark>(passFunc));
+
     //auto* cursor = new Cursor(passFunc);
     //pM->attachProcess(cursor);
 
@@ -358,6 +425,58 @@ int view::initialize() {
         TriggerEvent("UFO::Chat::AddMessage", "Window Resized: " + std::to_string(width) + "x" + std::to_string(height));
     });
 
+    RegisterCommand("profileEvents", [this](std::string command, sList_t args, std::string message) {
+        if (!EventProfiler::enabled) {
+            TriggerEvent("UFO::Chat::AddMessage", "Event profiling is off, rebuild with -DUFO_PROFILE_EVENTS=ON");
+            return;
+        }
+        if (!args.empty() && args[0] == "reset") {
+            EventProfiler::reset();
+            TriggerEvent("UFO::Chat::AddMessage", "Event profile reset");
+            return;
+        }
+        if (!args.empty() && args[0] == "csv") {
+            EventProfiler::dumpCsv(args.size() > 1 ? args[1] : "event_profile.csv");
+            return;
+        }
+
+        // Snapshot first, the chat messages below are events too
+        auto stats = EventProfiler::snapshot();
+        size_t shown = std::min<size_t>(stats.size(), args.empty() ? 10 : std::stoi(args[0]));
+        TriggerEvent("UFO::Chat::AddMessage", "event: dispatches, handlers, total ms, max ms, avg bytes");
+        for (size_t i = 0; i < shown; i++) {
+            auto& s = stats[i];
+            std::ostringstream line;
+            line << std::fixed << std::setprecision(2) << s.name << ": " << s.dispatches << ", " << s.handlers << ", "
+                 << s.totalMs << ", " << s.maxMs << ", " << (s.dispatches > 0 ? s.payloadBytes / s.dispatches : 0);
+            print(line.str());
+            TriggerEvent("UFO::Chat::AddMessage", line.str());
+        }
+        TriggerEvent("UFO::Chat::AddMessage", EventProfiler::frameUpdateSummary());
+    });
+
+    RegisterCommand("frameTimes", [this](std::string command, sList_t args, std::string message) {
+        if (!args.empty() && args[0] == "reset") {
+            FrameTimer::reset();
+            TriggerEvent("UFO::Chat::AddMessage", "Frame timings reset");
+            return;
+        }
+        if (!args.empty() && args[0] == "csv") {
+            FrameTimer::dumpCsv(args.size() > 1 ? args[1] : "frame_times.csv");
+            return;
+        }
+
+        auto stats = FrameTimer::percentiles();
+        TriggerEvent("UFO::Chat::AddMessage", "phase over " + std::to_string(FrameTimer::frameCount()) + " frames: p50, p95, p99, max ms");
+        for (auto& s : stats) {
+            std::ostringstream line;
+            line << std::fixed << std::setprecision(2) << s.name << ": " << s.p50 << ", " << s.p95 << ", " << s.p99
+                 << ", " << s.max;
+            print(line.str());
+            TriggerEvent("UFO::Chat::AddMessage", line.str());
+        }
+    });
+
     RegisterCommand("quit", [this](std::string command, sList_t args, std::string message) {
         TriggerEvent("UFO::Quit");
     });
@@ -435,50 +554,38 @@ void view::update(float deltaMs) {
     if (!running) return;
 
     // Clear screen
-    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255); // Black background
-    SDL_RenderClear(renderer);
+    if (!headlessMode) {
+        SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255); // Black background
+        SDL_RenderClear(renderer);
+    }
 
 
-    // Handle events on queue
+    // Handle events on queue, handlers see them once the whole batch is polled
     while (SDL_PollEvent(&e))
     {
         // User requests quit
         if( e.type == SDL_QUIT ) running = false;
 
-        // User presses a key
-        if( e.type == SDL_KEYDOWN )
-        {
-            if (!chatState) {
-                if( e.key.keysym.sym == SDLK_q ) {
-                    TriggerEvent("UFO::Quit");
-                    running = false;
-                }
-                if ( e.key.keysym.sym == SDLK_b ) {
-                    TriggerEvent("UFO::ChangeConfigValue", "debugMode");
-                }
-
-                if ( e.key.keysym.sym == SDLK_f ) {
-                    TriggerEvent("UFO::ChangeConfigValue", "unlimitedFrames");
-                }
-
-            }else {
-                const Uint8 *keyboard_state_array = SDL_GetKeyboardState(nullptr);
-                // if control q is pressed then quit
-                if (keyboard_state_array[SDL_SCANCODE_LCTRL] && e.key.keysym.sym == SDLK_q) {
-                    running = false;
-                }
-            }
-        }
-        TriggerEvent("SDL::OnPollEvent", e.type, e.key.keysym.sym);
+        QueueEvent(EventQueue::INPUT, "SDL::OnPollEvent", e.type, e.key.keysym.sym);
         if (e.type == SDL_TEXTINPUT) {
-            TriggerEvent("SDL::OnTextInput", e.text.text);
+            QueueEvent(EventQueue::INPUT, "SDL::OnTextInput", e.text.text);
         }
     }
+    EventQueue::flush(EventQueue::INPUT, passFunc);
+    FrameTimer::mark(FrameTimer::POLL);
+
+    if (headlessMode) { // nothing is drawn, render processes never see SDL::OnUpdate
+        EventQueue::discard(EventQueue::RENDER);
+        return;
+    }
 
     SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255); // White color
+    EventQueue::flush(EventQueue::RENDER, passFunc);
     TriggerEvent("SDL::OnUpdate", deltaMs);
     TriggerEvent("SDL::OnUpdate::Layer2", deltaMs); // second layer
+    FrameTimer::mark(FrameTimer::RENDER);
     SDL_RenderPresent(renderer);
+    FrameTimer::mark(FrameTimer::PRESENT);
 }
 
 bool view::isDone() {